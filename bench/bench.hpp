@@ -0,0 +1,73 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <print>
+#include <string_view>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+
+#if SW_COMPILER_MSVC
+    #include <intrin.h>
+#endif
+
+
+namespace bench
+{
+/** 컴파일러가 value를 계산하는 코드를 지우지 못하도록 막습니다. */
+template <typename T>
+SW_FORCE_INLINE void do_not_optimize(const T& value) noexcept
+{
+#if SW_COMPILER_MSVC
+    const volatile void* sink = &value;
+    (void)sink;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+/** 측정 결과 (반복 중 가장 빠른 값) */
+struct result
+{
+    double seconds = 0.0;
+    double ns_per_op = 0.0;
+    double ops_per_sec = 0.0;
+};
+
+/**
+ * fn()을 repeat번 실행하고 가장 빠른 실행 시간을 op_count로 나눠 반환합니다.
+ * fn 안에서 op_count개의 연산을 수행해야 합니다.
+ */
+template <typename Fn>
+[[nodiscard]] result measure(sw::usize op_count, Fn&& fn, int repeat = 3)
+{
+    using clock = std::chrono::steady_clock;
+
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < repeat; ++i)
+    {
+        const auto start = clock::now();
+        fn();
+        const auto elapsed = std::chrono::duration<double>(clock::now() - start).count();
+        best = std::min(best, elapsed);
+    }
+
+    const double ops = static_cast<double>(std::max<sw::usize>(op_count, 1));
+    return result{ best, best * 1e9 / ops, ops / best };
+}
+
+/** 결과 한 줄을 출력합니다. (이름, ns/op, Mops/s, 추가 정보) */
+inline void report(std::string_view name, const result& r, std::string_view extra = {})
+{
+    std::println("{:<44} {:>10.2f} ns/op {:>10.2f} Mops/s  {}", name, r.ns_per_op, r.ops_per_sec / 1e6, extra);
+}
+
+/** 벤치마크 묶음 제목을 출력합니다. */
+inline void section(std::string_view title)
+{
+    std::println("\n== {} ==", title);
+}
+} // namespace bench
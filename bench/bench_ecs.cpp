@@ -0,0 +1,177 @@
+#include <unordered_map>
+#include <vector>
+
+#include "sw/ecs.hpp"
+#include "bench.hpp"
+
+struct Position
+{
+    float x, y;
+};
+
+struct Velocity
+{
+    float x, y;
+};
+
+struct Health
+{
+    int value;
+};
+
+int main()
+{
+    constexpr sw::usize count = 1'000'000;
+
+    // 1. 생성/추가
+    bench::section("add (1M entities)");
+    {
+        const auto r = bench::measure(count, []
+        {
+            sw::registry reg;
+            for (sw::usize i = 0; i < count; ++i)
+            {
+                const sw::entity e = reg.create();
+                reg.emplace<Position>(e, 0.0f, 0.0f);
+                reg.emplace<Velocity>(e, 1.0f, 1.0f);
+            }
+            bench::do_not_optimize(reg.size());
+        });
+        bench::report("registry create + emplace<Position, Velocity>", r);
+    }
+    {
+        const auto r = bench::measure(count, []
+        {
+            std::unordered_map<sw::u32, Position> positions;
+            std::unordered_map<sw::u32, Velocity> velocities;
+            for (sw::u32 i = 0; i < count; ++i)
+            {
+                positions.emplace(i, Position{ 0.0f, 0.0f });
+                velocities.emplace(i, Velocity{ 1.0f, 1.0f });
+            }
+            bench::do_not_optimize(positions.size());
+        });
+        bench::report("unordered_map (baseline)", r);
+    }
+
+    sw::registry reg;
+    std::vector<sw::entity> entities;
+    entities.reserve(count);
+    for (sw::usize i = 0; i < count; ++i)
+    {
+        const sw::entity e = reg.create();
+        reg.emplace<Position>(e, 0.0f, 0.0f);
+        reg.emplace<Velocity>(e, 1.0f, 1.0f);
+        if (i % 2 == 0)
+        {
+            reg.emplace<Health>(e, 100);
+        }
+        entities.push_back(e);
+    }
+
+    // 2. 순회
+    bench::section("iterate (1M entities)");
+    {
+        const auto r = bench::measure(count, [&]
+        {
+            reg.view<Position>().each([](Position& p) { p.x += 1.0f; });
+        });
+        bench::report("view<Position>", r);
+    }
+    {
+        const auto r = bench::measure(count, [&]
+        {
+            reg.view<Position, Velocity>().each([](Position& p, const Velocity& v)
+            {
+                p.x += v.x;
+                p.y += v.y;
+            });
+        });
+        bench::report("view<Position, Velocity>", r);
+    }
+    {
+        sw::archetype_table<Position, Velocity> table;
+        table.reserve(count);
+        for (const sw::entity e : entities)
+        {
+            table.emplace_back(e, Position{ 0.0f, 0.0f }, Velocity{ 1.0f, 1.0f });
+        }
+
+        const auto r = bench::measure(count, [&]
+        {
+            auto pos = table.column<Position>();
+            auto vel = table.column<Velocity>();
+            for (sw::usize i = 0; i < table.size(); ++i)
+            {
+                pos[i].x += vel[i].x;
+                pos[i].y += vel[i].y;
+            }
+            bench::do_not_optimize(pos[0]);
+        });
+        bench::report("archetype_table<Position, Velocity> columns", r);
+    }
+
+    // 3. 조회
+    bench::section("query (1M entities)");
+    {
+        const auto r = bench::measure(count, [&]
+        {
+            sw::usize found = 0;
+            for (const sw::entity e : entities)
+            {
+                found += reg.has<Position, Health>(e);
+            }
+            bench::do_not_optimize(found);
+        });
+        bench::report("has<Position, Health>", r);
+    }
+    {
+        const auto r = bench::measure(count, [&]
+        {
+            float sum = 0.0f;
+            for (const sw::entity e : entities)
+            {
+                sum += reg.get<Velocity>(e).x;
+            }
+            bench::do_not_optimize(sum);
+        });
+        bench::report("get<Velocity>", r);
+    }
+
+    // 4. 삭제
+    bench::section("remove (1M entities)");
+    {
+        const auto r = bench::measure(count, [&]
+        {
+            for (const sw::entity e : entities)
+            {
+                reg.remove<Velocity>(e);
+            }
+            for (const sw::entity e : entities)
+            {
+                reg.emplace<Velocity>(e, 1.0f, 1.0f);
+            }
+        });
+        bench::report("remove<Velocity> + emplace<Velocity>", r);
+    }
+    {
+        const auto r = bench::measure(count, [&]
+        {
+            sw::registry local;
+            std::vector<sw::entity> created;
+            created.reserve(count);
+            for (sw::usize i = 0; i < count; ++i)
+            {
+                const sw::entity e = local.create();
+                local.emplace<Position>(e, 0.0f, 0.0f);
+                created.push_back(e);
+            }
+            for (const sw::entity e : created)
+            {
+                local.destroy(e);
+            }
+            bench::do_not_optimize(local.size());
+        }, 1);
+        bench::report("create + destroy", r);
+    }
+}
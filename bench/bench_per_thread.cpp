@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <atomic>
+#include <format>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "sw/per_thread.hpp"
+#include "bench.hpp"
+
+constexpr sw::usize iterations = 10'000'000;
+
+/** threads개의 스레드가 각자 body(t)를 실행하는 시간을 측정 */
+template <typename Body>
+bench::result run_threads(sw::usize threads, Body body)
+{
+    return bench::measure(iterations * threads, [&]
+    {
+        std::vector<std::thread> workers;
+        for (sw::usize t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&body, t] { body(t); });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    });
+}
+
+int main()
+{
+    const sw::usize hardware = std::max(std::thread::hardware_concurrency(), 2u);
+
+    for (sw::usize threads = 1; threads <= hardware; threads *= 2)
+    {
+        bench::section(std::format("counter increment, {} threads", threads));
+
+        // 모든 스레드가 하나의 atomic을 증가
+        {
+            std::atomic<sw::u64> shared{ 0 };
+            const auto r = run_threads(threads, [&](sw::usize)
+            {
+                for (sw::usize i = 0; i < iterations; ++i)
+                {
+                    shared.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+            bench::report("single std::atomic", r);
+        }
+
+        // 스레드마다 atomic을 따로 두지만 같은 캐시 라인에 붙어 있음 (false sharing)
+        {
+            auto packed = std::make_unique<std::atomic<sw::u64>[]>(threads);
+            const auto r = run_threads(threads, [&](sw::usize t)
+            {
+                for (sw::usize i = 0; i < iterations; ++i)
+                {
+                    packed[t].fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+            bench::report("std::atomic[] (adjacent)", r);
+        }
+
+        // 같은 배열을 cache_padded로 분리
+        {
+            auto padded = std::make_unique<sw::cache_padded<std::atomic<sw::u64>>[]>(threads);
+            const auto r = run_threads(threads, [&](sw::usize t)
+            {
+                for (sw::usize i = 0; i < iterations; ++i)
+                {
+                    padded[t]->fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+            bench::report("cache_padded<std::atomic>[]", r);
+        }
+
+        // sharded_counter (스레드 순번으로 샤드 선택)
+        {
+            sw::sharded_counter<sw::u64> counter;
+            const auto r = run_threads(threads, [&](sw::usize)
+            {
+                for (sw::usize i = 0; i < iterations; ++i)
+                {
+                    counter.increment();
+                }
+            });
+            bench::report("sharded_counter", r, std::format("value={}", counter.value()));
+        }
+
+        // per_thread<u64>: 자기 샤드만 쓰므로 atomic이 필요 없음
+        {
+            sw::per_thread<sw::u64> values;
+            const auto r = run_threads(threads, [&](sw::usize)
+            {
+                sw::u64& local = values.local();
+                for (sw::usize i = 0; i < iterations; ++i)
+                {
+                    bench::do_not_optimize(++local);
+                }
+            });
+            bench::report("per_thread<u64>", r);
+        }
+    }
+}
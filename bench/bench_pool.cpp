@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <thread>
+#include <vector>
+
+#include "sw/pool.hpp"
+#include "bench.hpp"
+
+struct Object
+{
+    sw::u64 key;
+    double value;
+    void* next;
+};
+
+struct new_delete
+{
+    Object* create() { return new Object{}; }
+    void destroy(Object* object) { delete object; }
+};
+
+struct pooled
+{
+    sw::object_pool<Object> pool;
+
+    Object* create() { return pool.create(); }
+    void destroy(Object* object) { pool.destroy(object); }
+};
+
+/** 한 스레드에서 batch개를 할당한 뒤 모두 해제하는 과정을 반복 */
+template <typename Allocator>
+void single_thread(const char* name, Allocator& allocator, sw::usize batch)
+{
+    constexpr sw::usize total = 4'000'000;
+    std::vector<Object*> objects(batch);
+
+    const auto r = bench::measure(total * 2, [&]
+    {
+        for (sw::usize done = 0; done < total; done += batch)
+        {
+            for (auto& object : objects)
+            {
+                object = allocator.create();
+            }
+            for (Object* object : objects)
+            {
+                allocator.destroy(object);
+            }
+        }
+    });
+    bench::report(std::format("{} batch={}", name, batch), r);
+}
+
+/** 할당 한 번의 지연 시간 분포 (p50/p99/p99.9/max) */
+template <typename Allocator>
+void latency(const char* name, Allocator& allocator)
+{
+    using clock = std::chrono::steady_clock;
+    constexpr sw::usize count = 1'000'000;
+
+    std::vector<Object*> objects(count);
+    std::vector<sw::i64> samples(count);
+    for (sw::usize i = 0; i < count; ++i)
+    {
+        const auto start = clock::now();
+        objects[i] = allocator.create();
+        samples[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+    }
+    for (Object* object : objects)
+    {
+        allocator.destroy(object);
+    }
+
+    std::ranges::sort(samples);
+    std::println("{:<44} p50 {:>5} ns  p99 {:>5} ns  p99.9 {:>6} ns  max {:>8} ns", name,
+                 samples[count / 2], samples[count * 99 / 100], samples[count * 999 / 1000], samples.back());
+}
+
+/** 생산자 스레드가 할당하고 소비자 스레드가 해제 */
+template <typename Allocator>
+void cross_thread(const char* name, Allocator& allocator)
+{
+    constexpr sw::usize count = 2'000'000;
+    std::vector<Object*> objects(count);
+
+    const auto r = bench::measure(count * 2, [&]
+    {
+        std::thread producer([&]
+        {
+            for (auto& object : objects)
+            {
+                object = allocator.create();
+            }
+        });
+        producer.join();
+
+        std::thread consumer([&]
+        {
+            for (Object* object : objects)
+            {
+                allocator.destroy(object);
+            }
+        });
+        consumer.join();
+    });
+    bench::report(std::format("{} producer -> consumer", name), r);
+}
+
+/** threads개의 스레드가 동시에 할당/해제 */
+template <typename Allocator>
+void contended(const char* name, Allocator& allocator, sw::usize threads)
+{
+    constexpr sw::usize per_thread = 1'000'000;
+    constexpr sw::usize batch = 64;
+
+    const auto r = bench::measure(per_thread * threads * 2, [&]
+    {
+        std::vector<std::thread> workers;
+        for (sw::usize t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&]
+            {
+                Object* objects[batch];
+                for (sw::usize done = 0; done < per_thread; done += batch)
+                {
+                    for (auto& object : objects)
+                    {
+                        object = allocator.create();
+                    }
+                    for (Object* object : objects)
+                    {
+                        allocator.destroy(object);
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    });
+    bench::report(std::format("{} threads={}", name, threads), r);
+}
+
+int main()
+{
+    new_delete heap;
+    pooled pool;
+
+    bench::section("single thread alloc + free");
+    for (const sw::usize batch : { 1, 64, 4096 })
+    {
+        single_thread("new/delete", heap, batch);
+        single_thread("object_pool", pool, batch);
+    }
+
+    bench::section("allocation latency (1M live objects)");
+    latency("new/delete", heap);
+    latency("object_pool", pool);
+
+    bench::section("cross-thread free");
+    cross_thread("new/delete", heap);
+    cross_thread("object_pool", pool);
+
+    bench::section("concurrent alloc + free");
+    const sw::usize hardware = std::max(std::thread::hardware_concurrency(), 2u);
+    for (sw::usize threads = 2; threads <= hardware; threads *= 2)
+    {
+        contended("new/delete", heap, threads);
+        contended("object_pool", pool, threads);
+    }
+}
@@ -0,0 +1,126 @@
+#include <format>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "sw/small_vector.hpp"
+#include "bench.hpp"
+
+constexpr sw::usize rounds = 1'000'000;
+
+/** i번째 원소 값 (문자열은 SSO보다 길게 만들어 복사 시 할당이 일어나도록 함) */
+template <typename T>
+T make_value(sw::usize i)
+{
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+        return std::string(32, static_cast<char>('a' + i % 26));
+    }
+    else
+    {
+        return static_cast<T>(i);
+    }
+}
+
+/** 비어 있는 벡터에 size개를 push_back하는 과정을 반복 */
+template <typename Vector>
+void push_back(const char* name, sw::usize size)
+{
+    const auto r = bench::measure(rounds * size, [&]
+    {
+        for (sw::usize round = 0; round < rounds; ++round)
+        {
+            Vector v;
+            for (sw::usize i = 0; i < size; ++i)
+            {
+                v.push_back(make_value<typename Vector::value_type>(i));
+            }
+            bench::do_not_optimize(v.data());
+        }
+    });
+    bench::report(std::format("{} size={}", name, size), r);
+}
+
+/** size개가 든 벡터를 복사 */
+template <typename Vector>
+void copy(const char* name, sw::usize size)
+{
+    Vector source;
+    for (sw::usize i = 0; i < size; ++i)
+    {
+        source.push_back(make_value<typename Vector::value_type>(i));
+    }
+
+    const auto r = bench::measure(rounds, [&]
+    {
+        for (sw::usize round = 0; round < rounds; ++round)
+        {
+            Vector copy = source;
+            bench::do_not_optimize(copy.data());
+        }
+    });
+    bench::report(std::format("{} size={}", name, size), r);
+}
+
+/** 작은 벡터 여러 개를 담은 배열을 순회하며 합산 (인라인 저장소는 간접 참조가 없음) */
+template <typename Vector>
+void iterate(const char* name, sw::usize size)
+{
+    constexpr sw::usize count = 100'000;
+    std::vector<Vector> vectors(count);
+    for (auto& v : vectors)
+    {
+        for (sw::usize i = 0; i < size; ++i)
+        {
+            v.push_back(make_value<typename Vector::value_type>(i));
+        }
+    }
+
+    const auto r = bench::measure(count * size, [&]
+    {
+        sw::u64 sum = 0;
+        for (const auto& v : vectors)
+        {
+            for (const auto x : v)
+            {
+                sum += x;
+            }
+        }
+        bench::do_not_optimize(sum);
+    }, 5);
+    bench::report(std::format("{} size={}", name, size), r);
+}
+
+int main()
+{
+    using std_vector = std::vector<sw::u32>;
+    using small_vector = sw::small_vector<sw::u32, 8>;
+
+    bench::section("push_back (per element)");
+    for (const sw::usize size : { 4, 8, 16, 64 })
+    {
+        push_back<std_vector>("std::vector<u32>", size);
+        push_back<small_vector>("small_vector<u32, 8>", size);
+    }
+
+    bench::section("copy (per vector)");
+    for (const sw::usize size : { 4, 8, 64 })
+    {
+        copy<std_vector>("std::vector<u32>", size);
+        copy<small_vector>("small_vector<u32, 8>", size);
+    }
+
+    bench::section("copy std::string elements (per vector)");
+    for (const sw::usize size : { 4, 16 })
+    {
+        copy<std::vector<std::string>>("std::vector<string>", size);
+        copy<sw::small_vector<std::string, 8>>("small_vector<string, 8>", size);
+    }
+
+    bench::section("iterate 100k vectors (per element)");
+    for (const sw::usize size : { 4, 8, 16 })
+    {
+        iterate<std_vector>("std::vector<u32>", size);
+        iterate<small_vector>("small_vector<u32, 8>", size);
+    }
+}
@@ -0,0 +1,165 @@
+// 타입 목록 연산의 컴파일 시간 측정용 소스 (bench/compile_benchmark.cmake에서 컴파일)
+// SW_BENCH_TYPE_COUNT: 목록 길이
+// SW_BENCH_RECURSIVE: 1이면 std::tuple 위의 재귀 구현(type_list 도입 이전 방식)으로 같은 연산을 수행 (비교 기준)
+//                     재귀 깊이가 목록 길이에 비례하므로 기본 -ftemplate-depth(900) 근처에서 컴파일이 실패합니다.
+#include <cstdio>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "sw/type_list.hpp"
+
+#ifndef SW_BENCH_TYPE_COUNT
+    #define SW_BENCH_TYPE_COUNT 500
+#endif
+
+#ifndef SW_BENCH_RECURSIVE
+    #define SW_BENCH_RECURSIVE 0
+#endif
+
+namespace bench_types
+{
+template <sw::usize I>
+using tag = std::integral_constant<sw::usize, I>;
+
+template <typename T>
+struct is_even_tag : std::bool_constant<T::value % 2 == 0> {};
+
+// unique가 실제로 중복을 제거하도록 값이 절반만큼만 다른 태그
+template <typename T>
+using halve_tag = tag<T::value / 2>;
+
+#if SW_BENCH_RECURSIVE
+template <typename... Ts>
+using list = std::tuple<Ts...>;
+
+template <typename... Tuples>
+using concat = decltype(std::tuple_cat(std::declval<Tuples>()...));
+
+template <typename T, typename List>
+struct index_of;
+
+template <typename T, typename... Ts>
+struct index_of<T, std::tuple<T, Ts...>> : std::integral_constant<sw::usize, 0> {};
+
+template <typename T, typename U, typename... Ts>
+struct index_of<T, std::tuple<U, Ts...>> : std::integral_constant<sw::usize, 1 + index_of<T, std::tuple<Ts...>>::value> {};
+
+template <typename List, template <typename> typename Pred>
+struct filter
+{
+    using type = std::tuple<>;
+};
+
+template <typename T, typename... Ts, template <typename> typename Pred>
+struct filter<std::tuple<T, Ts...>, Pred>
+{
+    using rest = typename filter<std::tuple<Ts...>, Pred>::type;
+    using type = std::conditional_t<Pred<T>::value, concat<std::tuple<T>, rest>, rest>;
+};
+
+template <typename List>
+struct unique
+{
+    using type = std::tuple<>;
+};
+
+template <typename T, typename... Ts>
+struct unique<std::tuple<T, Ts...>>
+{
+    using rest = typename unique<std::tuple<Ts...>>::type;
+    using type = std::conditional_t<(std::is_same_v<T, Ts> || ...), rest, concat<std::tuple<T>, rest>>;
+};
+
+template <typename T>
+struct flatten
+{
+    using type = std::tuple<T>;
+};
+
+template <typename... Ts>
+struct flatten<std::tuple<Ts...>>
+{
+    using type = concat<typename flatten<Ts>::type...>;
+};
+
+template <typename T, typename List>
+constexpr sw::usize index_of_v = index_of<T, List>::value;
+
+template <typename List, template <typename> typename Pred>
+using filter_t = typename filter<List, Pred>::type;
+
+template <typename List>
+using unique_t = typename unique<List>::type;
+
+template <typename List>
+using flatten_t = typename flatten<List>::type;
+
+template <typename List>
+constexpr sw::usize size_v = std::tuple_size_v<List>;
+#else
+template <typename... Ts>
+using list = sw::type_list<Ts...>;
+
+template <typename... Lists>
+using concat = sw::concat_t<Lists...>;
+
+template <typename T, typename List>
+constexpr sw::usize index_of_v = sw::index_of_v<List, T>;
+
+template <typename List, template <typename> typename Pred>
+using filter_t = sw::filter_t<List, Pred>;
+
+template <typename List>
+using unique_t = sw::unique_t<List>;
+
+template <typename List>
+using flatten_t = sw::flatten_t<List>;
+
+template <typename List>
+constexpr sw::usize size_v = List::size;
+#endif
+
+template <sw::usize... I>
+auto make_tags(std::index_sequence<I...>) -> list<tag<I>...>;
+
+template <sw::usize... I>
+auto make_halved_tags(std::index_sequence<I...>) -> list<halve_tag<tag<I>>...>;
+
+// 두 개씩 묶은 중첩 목록 (flatten 입력)
+template <sw::usize... I>
+auto make_pairs(std::index_sequence<I...>) -> list<list<tag<2 * I>, tag<2 * I + 1>>...>;
+
+template <typename List, sw::usize... I>
+constexpr sw::usize sum_indices(std::index_sequence<I...>)
+{
+    // 모든 원소를 하나씩 검색
+    return (index_of_v<tag<I>, List> + ...);
+}
+
+constexpr sw::usize count = SW_BENCH_TYPE_COUNT;
+
+using tags = decltype(make_tags(std::make_index_sequence<count>{}));
+using halved = decltype(make_halved_tags(std::make_index_sequence<count>{}));
+using pairs = decltype(make_pairs(std::make_index_sequence<count / 2>{}));
+} // namespace bench_types
+
+int main()
+{
+    using namespace bench_types;
+
+    constexpr sw::usize index_sum = sum_indices<tags>(std::make_index_sequence<count>{});
+    constexpr sw::usize even_count = size_v<filter_t<tags, is_even_tag>>;
+    constexpr sw::usize unique_count = size_v<unique_t<halved>>;
+    constexpr sw::usize flat_count = size_v<flatten_t<pairs>>;
+    constexpr sw::usize concat_count = size_v<concat<tags, halved, tags>>;
+
+    static_assert(index_sum == count * (count - 1) / 2);
+    static_assert(even_count == (count + 1) / 2);
+    static_assert(unique_count == (count + 1) / 2);
+    static_assert(flat_count == count / 2 * 2);
+    static_assert(concat_count == count * 3);
+
+    std::printf("%zu types: index_sum=%zu even=%zu unique=%zu flat=%zu concat=%zu\n",
+            count, index_sum, even_count, unique_count, flat_count, concat_count);
+}
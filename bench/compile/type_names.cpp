@@ -0,0 +1,59 @@
+// 타입 이름 문자열의 바이너리 크기/컴파일 시간 측정용 소스 (bench/compile_benchmark.cmake에서 컴파일)
+// SW_BENCH_TYPE_COUNT: 이름을 만들 타입 수
+// SW_BENCH_RAW_SIGNATURE: 1이면 컴파일러 시그니처 리터럴을 가리키는 이전 방식으로 이름을 얻음 (비교 기준)
+#include <array>
+#include <cstdio>
+#include <map>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "sw/type_signature.hpp"
+
+#ifndef SW_BENCH_TYPE_COUNT
+    #define SW_BENCH_TYPE_COUNT 1000
+#endif
+
+#ifndef SW_BENCH_RAW_SIGNATURE
+    #define SW_BENCH_RAW_SIGNATURE 0
+#endif
+
+namespace bench_types
+{
+template <sw::usize I>
+struct component
+{
+};
+
+// 실제 코드처럼 네임스페이스와 템플릿 인자가 섞인 긴 이름
+template <sw::usize I>
+using container = std::map<component<I>, std::vector<std::pair<int, component<I>>>>;
+} // namespace bench_types
+
+template <typename T>
+constexpr std::string_view name_of()
+{
+#if SW_BENCH_RAW_SIGNATURE
+    return sw::internal::extract_type_name<T>();
+#else
+    return sw::full_type_name<T>();
+#endif
+}
+
+template <sw::usize... I>
+constexpr auto make_names(std::index_sequence<I...>)
+{
+    return std::array<std::string_view, sizeof...(I)>{ name_of<bench_types::container<I>>()... };
+}
+
+int main()
+{
+    static constexpr auto names = make_names(std::make_index_sequence<SW_BENCH_TYPE_COUNT>{});
+
+    sw::usize bytes = 0;
+    for (const std::string_view name : names)
+    {
+        bytes += name.size();
+    }
+    std::printf("%zu types, %zu name bytes\n", names.size(), bytes);
+}
@@ -0,0 +1,71 @@
+# 컴파일 시간 / 바이너리 크기 벤치마크 (스크립트 모드)
+# bench/compile/*.cpp를 타입 수(SW_BENCH_TYPE_COUNT)를 바꿔 가며 직접 컴파일하고, 걸린 시간과 (strip한) 실행 파일 크기를 출력합니다.
+#
+# 사용법: cmake --build build --target bench_compile
+#   또는 cmake -DCOMPILER=<c++> -DCOMPILER_ID=<GNU|Clang|MSVC> -DSOURCE_DIR=<bench/compile>
+#              -DINCLUDE_DIR=<include> -DWORK_DIR=<출력 폴더> -P bench/compile_benchmark.cmake
+
+foreach(required COMPILER COMPILER_ID SOURCE_DIR INCLUDE_DIR WORK_DIR)
+    if (NOT DEFINED ${required})
+        message(FATAL_ERROR "compile_benchmark.cmake: ${required} is not set")
+    endif ()
+    # 컴파일은 WORK_DIR에서 실행하므로 절대 경로로 바꿈
+    if (required MATCHES "_DIR$")
+        get_filename_component(${required} "${${required}}" ABSOLUTE)
+    endif ()
+endforeach()
+
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+# source를 defines로 컴파일하고 결과를 한 줄로 출력
+function(run_case label source)
+    set(output ${WORK_DIR}/${label})
+    set(defines ${ARGN})
+
+    if (COMPILER_ID STREQUAL "MSVC")
+        list(TRANSFORM defines PREPEND "/D")
+        set(command ${COMPILER} /nologo /std:c++latest /O2 /EHsc /utf-8 /Zc:preprocessor /Zc:__cplusplus
+                /I${INCLUDE_DIR} ${defines} ${SOURCE_DIR}/${source} /Fe${output}.exe)
+        set(output ${output}.exe)
+    else ()
+        list(TRANSFORM defines PREPEND "-D")
+        set(command ${COMPILER} -std=c++23 -O2 -s -I${INCLUDE_DIR} ${defines} ${SOURCE_DIR}/${source} -o ${output})
+    endif ()
+
+    string(TIMESTAMP start "%s%f")
+    execute_process(COMMAND ${command}
+            WORKING_DIRECTORY ${WORK_DIR}
+            RESULT_VARIABLE result
+            ERROR_VARIABLE errors
+            OUTPUT_QUIET)
+    string(TIMESTAMP end "%s%f")
+
+    if (NOT result EQUAL 0)
+        message(WARNING "${label}: compile failed\n${errors}")
+        return()
+    endif ()
+
+    math(EXPR elapsed_ms "(${end} - ${start}) / 1000")
+    file(SIZE ${output} bytes)
+    string(LENGTH "${label}" label_length)
+    math(EXPR padding "40 - ${label_length}")
+    if (padding LESS 1)
+        set(padding 1)
+    endif ()
+    string(REPEAT " " ${padding} spaces)
+    message(STATUS "${label}${spaces}${elapsed_ms} ms  ${bytes} bytes")
+endfunction()
+
+# type_name/type_id 이름 문자열: 압축 배열(현재) vs 컴파일러 시그니처 리터럴(이전)
+foreach(count 250 500 1000 2000)
+    run_case(type_names_${count} type_names.cpp SW_BENCH_TYPE_COUNT=${count})
+    run_case(type_names_raw_signature_${count} type_names.cpp SW_BENCH_TYPE_COUNT=${count} SW_BENCH_RAW_SIGNATURE=1)
+endforeach()
+
+# 타입 목록 연산(index_of, filter, unique, flatten, concat): sw::type_list(현재) vs std::tuple 재귀 구현(이전)
+# 재귀 구현은 목록 길이만큼 인스턴스화가 중첩되므로 기본 깊이 한도(900) 아래의 길이까지만 비교
+foreach(count 100 250 500 800)
+    run_case(type_list_${count} type_list.cpp SW_BENCH_TYPE_COUNT=${count})
+    run_case(type_list_recursive_${count} type_list.cpp SW_BENCH_TYPE_COUNT=${count} SW_BENCH_RECURSIVE=1)
+endforeach()
+run_case(type_list_2000 type_list.cpp SW_BENCH_TYPE_COUNT=2000)
@@ -0,0 +1,536 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/type_signature.hpp"
+
+
+namespace sw
+{
+/** 크기 히스토그램 버킷 수 (버킷 i: [2^i, 2^(i+1)) 바이트, 마지막 버킷은 그 이상 전부) */
+inline constexpr usize alloc_histogram_buckets = 32;
+
+/** 태그 하나의 할당 통계 */
+struct alloc_tag_stats
+{
+    std::string_view name;
+    u64 allocations = 0;
+    u64 deallocations = 0;
+    u64 allocated_bytes = 0;
+    u64 freed_bytes = 0;
+    std::array<u64, alloc_histogram_buckets> size_histogram{};
+
+    /** 현재 살아 있는 바이트 수 */
+    [[nodiscard]] i64 live_bytes() const noexcept { return static_cast<i64>(allocated_bytes - freed_bytes); }
+
+    /** 현재 살아 있는 할당 수 */
+    [[nodiscard]] i64 live_count() const noexcept { return static_cast<i64>(allocations - deallocations); }
+};
+
+/** 특정 시점의 전체 할당 통계 */
+struct alloc_snapshot
+{
+    std::chrono::steady_clock::time_point time;
+    std::vector<alloc_tag_stats> tags; // 한 번이라도 할당이 기록된 태그만 포함
+
+    u64 allocations = 0;
+    u64 allocated_bytes = 0;
+    i64 live_bytes = 0;
+    u64 peak_bytes = 0; // 스레드별로 모아 두었다가 반영하므로 (스레드 수 * 64KiB) 이내의 오차가 있음
+
+    /** 이름으로 태그 통계를 찾습니다. 없으면 nullptr을 반환합니다. */
+    [[nodiscard]] const alloc_tag_stats* find(std::string_view name) const noexcept
+    {
+        const auto it = std::ranges::find(tags, name, &alloc_tag_stats::name);
+        return it != tags.end() ? &*it : nullptr;
+    }
+};
+
+/** earlier와 later 사이의 초당 할당 횟수를 반환합니다. */
+[[nodiscard]] inline double allocation_rate(const alloc_snapshot& earlier, const alloc_snapshot& later) noexcept
+{
+    const std::chrono::duration<double> elapsed = later.time - earlier.time;
+    if (elapsed.count() <= 0.0)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(later.allocations - earlier.allocations) / elapsed.count();
+}
+
+namespace internal
+{
+// 태그별 카운터는 페이지 단위로 필요할 때 할당
+constexpr usize alloc_tag_page_size = 64;
+constexpr usize alloc_max_tag_pages = 64;
+constexpr usize alloc_max_tags = alloc_tag_page_size * alloc_max_tag_pages;
+
+// 예약된 태그
+constexpr u32 alloc_untagged = 0;   // 태그 수 초과 시
+constexpr u32 alloc_global_new = 1; // 전역 operator new (SW_ALLOC_TRACKING_GLOBAL_NEW)
+
+// 스레드별 live 바이트 변화량이 이 값을 넘으면 전역 live/peak에 반영
+constexpr i64 alloc_peak_flush_bytes = 64 * 1024;
+
+/**
+ * 추적기 내부에서 일어나는 할당이 다시 기록되지 않도록 막는 스레드 로컬 플래그
+ * 자명한 타입이라 스레드 종료 중에도 안전하게 접근할 수 있습니다.
+ */
+inline thread_local bool alloc_tracking_paused = false;
+
+/** 범위 안에서 할당 기록을 멈춥니다. */
+class alloc_tracking_pause
+{
+public:
+    alloc_tracking_pause() noexcept
+        : previous(std::exchange(alloc_tracking_paused, true))
+    {
+    }
+
+    ~alloc_tracking_pause()
+    {
+        alloc_tracking_paused = previous;
+    }
+
+    alloc_tracking_pause(const alloc_tracking_pause&) = delete;
+    alloc_tracking_pause& operator=(const alloc_tracking_pause&) = delete;
+
+private:
+    bool previous;
+};
+
+[[nodiscard]] inline usize alloc_size_bucket(usize size) noexcept
+{
+    return size == 0 ? 0 : std::min<usize>(std::bit_width(size) - 1, alloc_histogram_buckets - 1);
+}
+
+/** 태그 하나의 카운터 (소유 스레드만 쓰므로 경합 없음) */
+struct alloc_counters
+{
+    std::atomic<u64> allocations{ 0 };
+    std::atomic<u64> deallocations{ 0 };
+    std::atomic<u64> allocated_bytes{ 0 };
+    std::atomic<u64> freed_bytes{ 0 };
+    std::array<std::atomic<u64>, alloc_histogram_buckets> size_histogram{};
+};
+
+/**
+ * 스레드 하나가 쓰는 카운터 블록
+ * 스레드가 종료되면 값을 유지한 채 다음 스레드가 재사용합니다.
+ */
+struct alignas(SW_CACHE_LINE_SIZE) alloc_thread_block
+{
+    std::array<std::atomic<alloc_counters*>, alloc_max_tag_pages> pages{};
+    std::atomic<i64> pending_live{ 0 };
+
+    ~alloc_thread_block()
+    {
+        for (auto& page : pages)
+        {
+            delete[] page.load(std::memory_order_relaxed);
+        }
+    }
+
+    /** tag의 카운터를 반환합니다. 페이지가 없으면 할당합니다. */
+    [[nodiscard]] alloc_counters& counters(u32 tag)
+    {
+        auto& slot = pages[tag / alloc_tag_page_size];
+        alloc_counters* page = slot.load(std::memory_order_acquire);
+        if (!page) [[unlikely]]
+        {
+            alloc_tracking_pause pause;
+            auto* fresh = new alloc_counters[alloc_tag_page_size];
+
+            // 스레드 종료 후 공유 블록은 여러 스레드가 함께 쓰므로 CAS로 설치
+            if (slot.compare_exchange_strong(page, fresh, std::memory_order_acq_rel))
+            {
+                page = fresh;
+            }
+            else
+            {
+                delete[] fresh;
+            }
+        }
+        return page[tag % alloc_tag_page_size];
+    }
+
+    /** 페이지가 있을 때만 tag의 카운터를 반환합니다. (읽기 전용) */
+    [[nodiscard]] const alloc_counters* find_counters(u32 tag) const noexcept
+    {
+        const alloc_counters* page = pages[tag / alloc_tag_page_size].load(std::memory_order_acquire);
+        return page ? &page[tag % alloc_tag_page_size] : nullptr;
+    }
+};
+
+/** 태그 이름과 스레드 블록을 관리하는 전역 저장소 */
+class alloc_registry
+{
+public:
+    alloc_registry() noexcept
+    {
+        names[alloc_untagged] = "<untagged>";
+        names[alloc_global_new] = "operator new";
+        tag_count.store(2, std::memory_order_release);
+    }
+
+    /** 이름에 해당하는 태그를 등록하고 반환합니다. 이미 있으면 기존 태그를 반환합니다. */
+    [[nodiscard]] u32 register_tag(std::string_view name) noexcept
+    {
+        std::scoped_lock lock{ tag_mutex };
+        const u32 count = tag_count.load(std::memory_order_relaxed);
+        for (u32 i = 0; i < count; ++i)
+        {
+            if (names[i] == name)
+            {
+                return i;
+            }
+        }
+        if (count == alloc_max_tags)
+        {
+            return alloc_untagged;
+        }
+
+        names[count] = name;
+        tag_count.store(count + 1, std::memory_order_release);
+        return count;
+    }
+
+    [[nodiscard]] u32 registered_tags() const noexcept
+    {
+        return tag_count.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] std::string_view tag_name(u32 tag) const noexcept
+    {
+        return names[tag];
+    }
+
+    /** 스레드용 블록을 하나 가져옵니다. */
+    [[nodiscard]] alloc_thread_block* acquire_block()
+    {
+        alloc_tracking_pause pause;
+        std::scoped_lock lock{ block_mutex };
+        if (!free_blocks.empty())
+        {
+            alloc_thread_block* block = free_blocks.back();
+            free_blocks.pop_back();
+            return block;
+        }
+        return blocks.emplace_back(std::make_unique<alloc_thread_block>()).get();
+    }
+
+    /** 종료하는 스레드의 블록을 반납합니다. 카운터 값은 그대로 유지됩니다. */
+    void release_block(alloc_thread_block* block)
+    {
+        alloc_tracking_pause pause;
+        flush_live(block->pending_live.exchange(0, std::memory_order_relaxed));
+
+        std::scoped_lock lock{ block_mutex };
+        free_blocks.push_back(block);
+    }
+
+    /** 스레드 로컬 블록이 이미 파괴된 뒤(스레드 종료 중)의 할당을 받는 공유 블록 */
+    [[nodiscard]] alloc_thread_block& shared_block() noexcept
+    {
+        return orphan;
+    }
+
+    /** 모든 블록에 대해 fn(const alloc_thread_block&)을 호출합니다. */
+    template <typename Fn>
+    void for_each_block(Fn&& fn) const
+    {
+        std::scoped_lock lock{ block_mutex };
+        for (const auto& block : blocks)
+        {
+            fn(*block);
+        }
+        fn(orphan);
+    }
+
+    /** 스레드에 모아 둔 live 변화량을 전역 live/peak에 반영합니다. */
+    void flush_live(i64 delta) noexcept
+    {
+        const i64 now = live.fetch_add(delta, std::memory_order_relaxed) + delta;
+        i64 current_peak = peak.load(std::memory_order_relaxed);
+        while (now > current_peak && !peak.compare_exchange_weak(current_peak, now, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    [[nodiscard]] i64 peak_bytes() const noexcept
+    {
+        return peak.load(std::memory_order_relaxed);
+    }
+
+    void reset_peak() noexcept
+    {
+        peak.store(live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+private:
+    std::mutex tag_mutex;
+    std::array<std::string_view, alloc_max_tags> names{};
+    std::atomic<u32> tag_count{ 0 };
+
+    mutable std::mutex block_mutex;
+    std::vector<std::unique_ptr<alloc_thread_block>> blocks;
+    std::vector<alloc_thread_block*> free_blocks;
+    alloc_thread_block orphan;
+
+    std::atomic<i64> live{ 0 };
+    std::atomic<i64> peak{ 0 };
+};
+
+/** 전역 저장소 (정적 객체 소멸 중의 할당도 기록할 수 있도록 해제하지 않음) */
+[[nodiscard]] inline alloc_registry& alloc_tracker_registry()
+{
+    static alloc_registry* const instance = []
+    {
+        alloc_tracking_pause pause;
+        return new alloc_registry;
+    }();
+    return *instance;
+}
+
+/** 현재 스레드의 블록 상태 (자명한 타입) */
+struct alloc_thread_state
+{
+    alloc_thread_block* block = nullptr;
+    bool exited = false;
+};
+
+inline thread_local alloc_thread_state alloc_thread;
+
+/** 스레드 종료 시 블록을 반납하는 객체 */
+struct alloc_thread_exit
+{
+    bool armed = false;
+
+    ~alloc_thread_exit()
+    {
+        if (alloc_thread.block)
+        {
+            alloc_tracker_registry().release_block(alloc_thread.block);
+        }
+        alloc_thread.block = nullptr;
+        alloc_thread.exited = true;
+    }
+};
+
+inline thread_local alloc_thread_exit alloc_thread_exit_hook;
+
+[[nodiscard]] inline alloc_thread_block& current_alloc_block()
+{
+    if (alloc_thread.block) [[likely]]
+    {
+        return *alloc_thread.block;
+    }
+    if (alloc_thread.exited)
+    {
+        return alloc_tracker_registry().shared_block();
+    }
+
+    alloc_tracking_pause pause;
+    alloc_thread.block = alloc_tracker_registry().acquire_block();
+    alloc_thread_exit_hook.armed = true; // 소멸자가 등록되도록 스레드 로컬 객체를 사용
+    return *alloc_thread.block;
+}
+} // namespace internal
+
+/**
+ * 할당 추적기
+ * swlib의 할당 지점(sw::function/sw::poly 힙 저장, sw::arena 블록, sw::fixed_pool 청크)과
+ * 선택적으로 전역 operator new를 태그별로 기록합니다. 카운터는 스레드별로 분리되어 있어 경합이 없습니다.
+ *
+ * SW_ALLOC_TRACKING을 켜야 swlib 내부 훅이 활성화되며 (CMake: -DSW_ALLOC_TRACKING=ON),
+ * SW_ALLOC_TRACKING_GLOBAL_NEW를 켜면 전역 operator new/delete도 "operator new" 태그로 기록합니다.
+ *
+ * @code
+ * const auto before = sw::alloc_tracker::snapshot();
+ * run_frame();
+ * const auto after = sw::alloc_tracker::snapshot();
+ * double per_second = sw::allocation_rate(before, after);
+ * if (const auto* pool = after.find("sw::internal::pool_depot")) { ... }
+ * @endcode
+ */
+class alloc_tracker
+{
+public:
+    /** swlib 내부 훅이 켜져 있는지 여부 */
+    static constexpr bool enabled = SW_ALLOC_TRACKING;
+
+public:
+    /**
+     * 이름으로 태그를 등록합니다. 같은 이름은 같은 태그가 됩니다.
+     * @param name 정적 수명을 가진 문자열이어야 함 (문자열 리터럴 등)
+     */
+    [[nodiscard]] static u32 tag(std::string_view name) noexcept
+    {
+        return internal::alloc_tracker_registry().register_tag(name);
+    }
+
+    /** 타입 T의 이름(full_type_name)으로 된 태그를 반환합니다. */
+    template <typename T>
+    [[nodiscard]] static u32 tag_of() noexcept
+    {
+        static const u32 id = tag(full_type_name<T>());
+        return id;
+    }
+
+    /** size 바이트 할당을 tag로 기록합니다. */
+    static void record_allocation(u32 tag, usize size) noexcept
+    {
+        if (internal::alloc_tracking_paused)
+        {
+            return;
+        }
+        internal::alloc_tracking_pause pause;
+
+        auto& block = internal::current_alloc_block();
+        auto& counters = block.counters(tag);
+        counters.allocations.fetch_add(1, std::memory_order_relaxed);
+        counters.allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+        counters.size_histogram[internal::alloc_size_bucket(size)].fetch_add(1, std::memory_order_relaxed);
+        add_live(block, static_cast<i64>(size));
+    }
+
+    /** size 바이트 해제를 tag로 기록합니다. */
+    static void record_deallocation(u32 tag, usize size) noexcept
+    {
+        if (internal::alloc_tracking_paused)
+        {
+            return;
+        }
+        internal::alloc_tracking_pause pause;
+
+        auto& block = internal::current_alloc_block();
+        auto& counters = block.counters(tag);
+        counters.deallocations.fetch_add(1, std::memory_order_relaxed);
+        counters.freed_bytes.fetch_add(size, std::memory_order_relaxed);
+        add_live(block, -static_cast<i64>(size));
+    }
+
+    /**
+     * Tag 타입으로 기록하며 메모리를 할당합니다.
+     * 내부의 operator new 호출은 전역 훅에 중복 기록되지 않습니다.
+     */
+    template <typename Tag>
+    [[nodiscard]] static void* allocate(usize size, usize alignment)
+    {
+        const u32 id = tag_of<Tag>();
+        void* ptr;
+        {
+            internal::alloc_tracking_pause pause;
+            ptr = (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                ? ::operator new(size, std::align_val_t{ alignment })
+                : ::operator new(size);
+        }
+        record_allocation(id, size);
+        return ptr;
+    }
+
+    /** allocate()로 할당한 메모리를 해제합니다. */
+    template <typename Tag>
+    static void deallocate(void* ptr, usize size, usize alignment) noexcept
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        record_deallocation(tag_of<Tag>(), size);
+        internal::alloc_tracking_pause pause;
+        if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            ::operator delete(ptr, size, std::align_val_t{ alignment });
+        }
+        else
+        {
+            ::operator delete(ptr, size);
+        }
+    }
+
+    /** 모든 스레드의 카운터를 합산한 통계를 반환합니다. */
+    [[nodiscard]] static alloc_snapshot snapshot()
+    {
+        internal::alloc_tracking_pause pause;
+        auto& registry = internal::alloc_tracker_registry();
+
+        const u32 tag_count = registry.registered_tags();
+        std::vector<alloc_tag_stats> per_tag(tag_count);
+        registry.for_each_block([&](const internal::alloc_thread_block& block)
+        {
+            for (u32 tag = 0; tag < tag_count; ++tag)
+            {
+                const auto* counters = block.find_counters(tag);
+                if (!counters)
+                {
+                    tag = static_cast<u32>(aligned_page_end(tag)) - 1; // 빈 페이지 건너뛰기
+                    continue;
+                }
+
+                auto& stats = per_tag[tag];
+                stats.allocations += counters->allocations.load(std::memory_order_relaxed);
+                stats.deallocations += counters->deallocations.load(std::memory_order_relaxed);
+                stats.allocated_bytes += counters->allocated_bytes.load(std::memory_order_relaxed);
+                stats.freed_bytes += counters->freed_bytes.load(std::memory_order_relaxed);
+                for (usize i = 0; i < alloc_histogram_buckets; ++i)
+                {
+                    stats.size_histogram[i] += counters->size_histogram[i].load(std::memory_order_relaxed);
+                }
+            }
+        });
+
+        alloc_snapshot result;
+        result.time = std::chrono::steady_clock::now();
+        for (u32 tag = 0; tag < tag_count; ++tag)
+        {
+            auto& stats = per_tag[tag];
+            if (stats.allocations == 0 && stats.deallocations == 0)
+            {
+                continue;
+            }
+
+            stats.name = registry.tag_name(tag);
+            result.allocations += stats.allocations;
+            result.allocated_bytes += stats.allocated_bytes;
+            result.live_bytes += stats.live_bytes();
+            result.tags.push_back(stats);
+        }
+        result.peak_bytes = static_cast<u64>(std::max(registry.peak_bytes(), result.live_bytes));
+        return result;
+    }
+
+    /** 최대 사용량을 현재 사용량으로 되돌립니다. (구간별 peak 측정용) */
+    static void reset_peak() noexcept
+    {
+        internal::alloc_tracker_registry().reset_peak();
+    }
+
+private:
+    static void add_live(internal::alloc_thread_block& block, i64 delta) noexcept
+    {
+        const i64 pending = block.pending_live.fetch_add(delta, std::memory_order_relaxed) + delta;
+        if (pending >= internal::alloc_peak_flush_bytes || pending <= -internal::alloc_peak_flush_bytes)
+        {
+            internal::alloc_tracker_registry().flush_live(block.pending_live.exchange(0, std::memory_order_relaxed));
+        }
+    }
+
+    [[nodiscard]] static constexpr usize aligned_page_end(u32 tag) noexcept
+    {
+        return (tag / internal::alloc_tag_page_size + 1) * internal::alloc_tag_page_size;
+    }
+};
+} // namespace sw
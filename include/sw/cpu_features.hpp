@@ -0,0 +1,236 @@
+#pragma once
+
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+
+
+namespace sw
+{
+/** 실행 중에 확인하는 CPU 확장 명령어 (비트 플래그) */
+enum class cpu_feature : u64
+{
+    none = 0,
+
+    // x86 / x64
+    sse2     = u64{ 1 } << 0,
+    sse3     = u64{ 1 } << 1,
+    ssse3    = u64{ 1 } << 2,
+    sse4_1   = u64{ 1 } << 3,
+    sse4_2   = u64{ 1 } << 4,
+    popcnt   = u64{ 1 } << 5,
+    aes      = u64{ 1 } << 6,
+    sha      = u64{ 1 } << 7,
+    avx      = u64{ 1 } << 8,  // OS가 YMM 레지스터 저장을 지원하는 경우에만 설정
+    avx2     = u64{ 1 } << 9,
+    fma      = u64{ 1 } << 10,
+    f16c     = u64{ 1 } << 11,
+    bmi1     = u64{ 1 } << 12,
+    bmi2     = u64{ 1 } << 13,
+    avx512f  = u64{ 1 } << 14, // OS가 ZMM/opmask 레지스터 저장을 지원하는 경우에만 설정
+    avx512dq = u64{ 1 } << 15,
+    avx512bw = u64{ 1 } << 16,
+    avx512vl = u64{ 1 } << 17,
+
+    // ARM64
+    neon     = u64{ 1 } << 32,
+    crc32    = u64{ 1 } << 33,
+    arm_aes  = u64{ 1 } << 34,
+    arm_sha2 = u64{ 1 } << 35,
+    sve      = u64{ 1 } << 36,
+    sve2     = u64{ 1 } << 37,
+
+    // 자주 함께 요구하는 조합 (x86-64 마이크로아키텍처 수준)
+    x86_64_v2 = sse3 | ssse3 | sse4_1 | sse4_2 | popcnt,
+    x86_64_v3 = x86_64_v2 | avx | avx2 | fma | f16c | bmi1 | bmi2,
+    x86_64_v4 = x86_64_v3 | avx512f | avx512dq | avx512bw | avx512vl,
+};
+
+[[nodiscard]] constexpr cpu_feature operator|(cpu_feature lhs, cpu_feature rhs) noexcept
+{
+    return static_cast<cpu_feature>(static_cast<u64>(lhs) | static_cast<u64>(rhs));
+}
+
+[[nodiscard]] constexpr cpu_feature operator&(cpu_feature lhs, cpu_feature rhs) noexcept
+{
+    return static_cast<cpu_feature>(static_cast<u64>(lhs) & static_cast<u64>(rhs));
+}
+
+/** 단일 플래그의 이름 (조합이나 알 수 없는 값은 빈 문자열) */
+[[nodiscard]] constexpr std::string_view cpu_feature_name(cpu_feature feature) noexcept
+{
+    switch (feature)
+    {
+        case cpu_feature::sse2: return "sse2";
+        case cpu_feature::sse3: return "sse3";
+        case cpu_feature::ssse3: return "ssse3";
+        case cpu_feature::sse4_1: return "sse4.1";
+        case cpu_feature::sse4_2: return "sse4.2";
+        case cpu_feature::popcnt: return "popcnt";
+        case cpu_feature::aes: return "aes";
+        case cpu_feature::sha: return "sha";
+        case cpu_feature::avx: return "avx";
+        case cpu_feature::avx2: return "avx2";
+        case cpu_feature::fma: return "fma";
+        case cpu_feature::f16c: return "f16c";
+        case cpu_feature::bmi1: return "bmi1";
+        case cpu_feature::bmi2: return "bmi2";
+        case cpu_feature::avx512f: return "avx512f";
+        case cpu_feature::avx512dq: return "avx512dq";
+        case cpu_feature::avx512bw: return "avx512bw";
+        case cpu_feature::avx512vl: return "avx512vl";
+        case cpu_feature::neon: return "neon";
+        case cpu_feature::crc32: return "crc32";
+        case cpu_feature::arm_aes: return "aes";
+        case cpu_feature::arm_sha2: return "sha2";
+        case cpu_feature::sve: return "sve";
+        case cpu_feature::sve2: return "sve2";
+        default: return {};
+    }
+}
+
+namespace internal
+{
+// 플랫폼별 구현은 src/cpu_features.cpp에 있음 (x86: cpuid + xgetbv, Linux ARM64: getauxval)
+[[nodiscard]] u64 detect_cpu_features() noexcept;
+} // namespace internal
+
+/**
+ * 현재 CPU가 지원하는 확장 명령어 집합
+ * SW_ARCH_* 매크로는 컴파일 대상만 알려 주므로, 같은 바이너리가 실행되는 CPU에 따라 달라지는 기능은 이 값으로 확인합니다.
+ *
+ * @code
+ * if (sw::cpu_features::current().has(sw::cpu_feature::avx2 | sw::cpu_feature::bmi2)) { ... }
+ * @endcode
+ */
+class cpu_features
+{
+public:
+    constexpr cpu_features() noexcept = default;
+
+    /** 임의의 기능 조합 (테스트에서 낮은 사양의 CPU를 흉내낼 때 사용) */
+    constexpr explicit cpu_features(cpu_feature features) noexcept
+        : mask(static_cast<u64>(features))
+    {
+    }
+
+    /** 실행 중인 CPU의 기능 (처음 호출할 때 한 번만 검사) */
+    [[nodiscard]] static const cpu_features& current() noexcept
+    {
+        static const cpu_features detected{ static_cast<cpu_feature>(internal::detect_cpu_features()) };
+        return detected;
+    }
+
+    /** 요구한 기능을 모두 지원하는지 여부 (none은 항상 true) */
+    [[nodiscard]] constexpr bool has(cpu_feature required) const noexcept
+    {
+        return (mask & static_cast<u64>(required)) == static_cast<u64>(required);
+    }
+
+    /** 지정한 기능을 뺀 집합 */
+    [[nodiscard]] constexpr cpu_features without(cpu_feature removed) const noexcept
+    {
+        return cpu_features{ static_cast<cpu_feature>(mask & ~static_cast<u64>(removed)) };
+    }
+
+    [[nodiscard]] constexpr cpu_feature features() const noexcept { return static_cast<cpu_feature>(mask); }
+
+    /** 지원하는 기능 이름을 공백으로 구분한 문자열 (로그/진단용) */
+    [[nodiscard]] std::string to_string() const
+    {
+        std::string result;
+        for (u32 bit = 0; bit < 64; ++bit)
+        {
+            const auto feature = static_cast<cpu_feature>(u64{ 1 } << bit);
+            if (has(feature) && !cpu_feature_name(feature).empty())
+            {
+                if (!result.empty())
+                {
+                    result += ' ';
+                }
+                result += cpu_feature_name(feature);
+            }
+        }
+        return result;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const cpu_features&) const noexcept = default;
+
+private:
+    u64 mask = 0;
+};
+
+template <typename Signature>
+class cpu_dispatch;
+
+/**
+ * 같은 커널의 여러 구현 중 CPU가 지원하는 가장 좋은 것을 한 번만 골라 두는 함수 포인터 (ifunc 방식)
+ * 선택은 생성 시점(보통 정적 초기화)에 끝나므로 호출 비용은 간접 호출 한 번입니다.
+ * 후보는 우선순위 순서로 나열하며, 마지막 후보는 요구 기능이 없는 범용 구현이어야 합니다.
+ * 각 구현은 SW_TARGET으로 해당 명령어 집합을 켜고 컴파일합니다.
+ *
+ * @code
+ * SW_TARGET("avx2") usize count_avx2(const u8* data, usize size);
+ * usize count_scalar(const u8* data, usize size);
+ *
+ * inline const sw::cpu_dispatch<usize(const u8*, usize)> count_bytes{
+ *     { count_avx2, sw::cpu_feature::avx2 },
+ *     { count_scalar },
+ * };
+ * usize n = count_bytes(data, size);
+ * @endcode
+ */
+template <typename R, typename... Args>
+class cpu_dispatch<R(Args...)>
+{
+public:
+    using function_type = R (*)(Args...);
+
+    /** 구현 후보: 함수와 그 함수가 요구하는 기능 */
+    struct candidate
+    {
+        function_type function = nullptr;
+        cpu_feature required = cpu_feature::none;
+    };
+
+    /**
+     * @param candidates 우선순위 순서의 구현 후보
+     * @param features 선택 기준 (기본값: 실행 중인 CPU)
+     * @throw std::invalid_argument 지원되는 후보가 하나도 없는 경우
+     */
+    cpu_dispatch(std::initializer_list<candidate> candidates, const cpu_features& features = cpu_features::current())
+        : target(select(candidates, features))
+    {
+    }
+
+    template <typename... CallArgs>
+    R operator()(CallArgs&&... args) const
+    {
+        return target(std::forward<CallArgs>(args)...);
+    }
+
+    /** 선택된 구현 */
+    [[nodiscard]] function_type get() const noexcept { return target; }
+
+    /** 후보 중 features에서 실행 가능한 첫 번째 구현 */
+    [[nodiscard]] static function_type select(std::initializer_list<candidate> candidates, const cpu_features& features)
+    {
+        for (const candidate& entry : candidates)
+        {
+            if (entry.function && features.has(entry.required))
+            {
+                return entry.function;
+            }
+        }
+        throw std::invalid_argument("cpu_dispatch: no candidate is supported by this CPU");
+    }
+
+private:
+    function_type target;
+};
+} // namespace sw
@@ -0,0 +1,621 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <memory>
+#include <new>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "sw/types.hpp"
+#include "sw/memory.hpp"
+#include "sw/type_id.hpp"
+
+
+namespace sw
+{
+/**
+ * ECS 엔티티 식별자
+ * 인덱스와 세대(generation)로 구성되어, 파괴 후 재사용된 인덱스를 구분할 수 있습니다.
+ */
+struct entity
+{
+    u32 index = ~u32{ 0 };
+    u32 generation = 0;
+
+    [[nodiscard]] constexpr bool is_valid() const noexcept { return index != ~u32{ 0 }; }
+    [[nodiscard]] explicit constexpr operator bool() const noexcept { return is_valid(); }
+    [[nodiscard]] constexpr bool operator==(const entity&) const = default;
+};
+
+/** 유효하지 않은 엔티티 */
+inline constexpr entity null_entity{};
+
+namespace internal
+{
+// 희소 배열(sparse)에서 비어 있는 칸을 나타내는 값
+constexpr u32 sparse_npos = ~u32{ 0 };
+
+// archetype_table 컬럼 정렬 (SIMD 로드/캐시 라인 단위)
+constexpr usize ecs_column_alignment = 64;
+
+/** 타입 소거된 컴포넌트 풀 인터페이스 (registry에서 엔티티 파괴 시 사용) */
+class component_pool_base
+{
+public:
+    virtual ~component_pool_base() = default;
+
+    virtual bool remove(entity e) = 0;
+
+    [[nodiscard]] usize size() const noexcept { return dense.size(); }
+    [[nodiscard]] bool empty() const noexcept { return dense.empty(); }
+
+    /** 엔티티가 이 풀에 컴포넌트를 가지고 있는지 확인합니다. */
+    [[nodiscard]] bool contains(entity e) const noexcept
+    {
+        if (e.index >= sparse.size())
+        {
+            return false;
+        }
+        const u32 pos = sparse[e.index];
+        return pos != sparse_npos && dense[pos] == e;
+    }
+
+    /** 밀집(dense) 배열에 저장된 엔티티 목록을 반환합니다. */
+    [[nodiscard]] std::span<const entity> entities() const noexcept { return dense; }
+
+protected:
+    [[nodiscard]] u32 index_of(entity e) const noexcept
+    {
+        return sparse[e.index];
+    }
+
+    u32 push_entity(entity e)
+    {
+        if (e.index >= sparse.size())
+        {
+            sparse.resize(std::max<usize>(e.index + 1, sparse.size() * 2), sparse_npos);
+        }
+        const auto pos = static_cast<u32>(dense.size());
+        sparse[e.index] = pos;
+        dense.push_back(e);
+        return pos;
+    }
+
+    /** pos의 엔티티를 마지막 엔티티와 교체한 뒤 제거합니다. (swap-and-pop) */
+    void pop_entity(u32 pos) noexcept
+    {
+        const entity last = dense.back();
+        sparse[last.index] = pos;
+        sparse[dense[pos].index] = sparse_npos;
+        dense[pos] = last;
+        dense.pop_back();
+    }
+
+protected:
+    std::vector<u32> sparse;
+    std::vector<entity> dense;
+};
+
+/** 모든 타입이 서로 다른지 확인 */
+template <typename... Ts>
+constexpr bool types_are_unique = true;
+
+template <typename T, typename... Ts>
+constexpr bool types_are_unique<T, Ts...> = (!std::same_as<T, Ts> && ...) && types_are_unique<Ts...>;
+} // namespace internal
+
+/**
+ * 컴포넌트 T에 대한 희소 집합(sparse set) 풀
+ * 컴포넌트는 밀집 배열에 연속으로 저장되며 추가/삭제/조회가 모두 O(1)입니다.
+ */
+template <typename T>
+class component_pool final : public internal::component_pool_base
+{
+public:
+    /** 엔티티에 컴포넌트를 생성합니다. 이미 있으면 값을 교체합니다. */
+    template <typename... Args>
+    T& emplace(entity e, Args&&... args)
+    {
+        if (contains(e))
+        {
+            T& component = components[index_of(e)];
+            component = T(std::forward<Args>(args)...);
+            return component;
+        }
+
+        // 컴포넌트를 먼저 생성해 생성자가 던져도 엔티티가 등록되지 않도록 함
+        T& component = components.emplace_back(std::forward<Args>(args)...);
+        try
+        {
+            push_entity(e);
+        }
+        catch (...)
+        {
+            components.pop_back();
+            throw;
+        }
+        return component;
+    }
+
+    virtual bool remove(entity e) override
+    {
+        if (!contains(e))
+        {
+            return false;
+        }
+
+        const u32 pos = index_of(e);
+        if (pos + 1 != components.size())
+        {
+            components[pos] = std::move(components.back());
+        }
+        components.pop_back();
+        pop_entity(pos);
+        return true;
+    }
+
+    [[nodiscard]] T& get(entity e) noexcept
+    {
+        return components[index_of(e)];
+    }
+
+    [[nodiscard]] const T& get(entity e) const noexcept
+    {
+        return components[index_of(e)];
+    }
+
+    [[nodiscard]] T* try_get(entity e) noexcept
+    {
+        return contains(e) ? &components[index_of(e)] : nullptr;
+    }
+
+    /** 밀집 배열에 저장된 컴포넌트 목록을 반환합니다. (entities()와 같은 순서) */
+    [[nodiscard]] std::span<T> data() noexcept { return components; }
+    [[nodiscard]] std::span<const T> data() const noexcept { return components; }
+
+private:
+    std::vector<T> components;
+};
+
+/**
+ * 여러 컴포넌트를 모두 가진 엔티티를 순회하는 뷰
+ * 가장 작은 풀의 밀집 배열을 기준으로 순회하며 나머지 풀은 희소 배열로 확인합니다.
+ */
+template <typename... Ts>
+    requires (sizeof...(Ts) > 0)
+class view
+{
+public:
+    explicit view(component_pool<Ts>*... pools) noexcept
+        : pools{ pools... }
+    {
+    }
+
+    /**
+     * fn(entity, Ts&...) 또는 fn(Ts&...)를 호출합니다.
+     * @note 순회 중에 순회 대상 컴포넌트를 추가/삭제하면 안 됩니다.
+     */
+    template <typename Fn>
+    void each(Fn&& fn)
+    {
+        if (!(std::get<component_pool<Ts>*>(pools) && ...))
+        {
+            return;
+        }
+
+        if constexpr (sizeof...(Ts) == 1)
+        {
+            // 단일 컴포넌트는 밀집 배열을 그대로 순회
+            auto* pool = std::get<0>(pools);
+            const auto entities = pool->entities();
+            const auto components = pool->data();
+            for (usize i = 0; i < components.size(); ++i)
+            {
+                invoke(fn, entities[i], components[i]);
+            }
+        }
+        else
+        {
+            const internal::component_pool_base* lead = smallest_pool();
+            for (const entity e : lead->entities())
+            {
+                if ((std::get<component_pool<Ts>*>(pools)->contains(e) && ...))
+                {
+                    invoke(fn, e, std::get<component_pool<Ts>*>(pools)->get(e)...);
+                }
+            }
+        }
+    }
+
+    /** 순회 대상 엔티티 수의 상한을 반환합니다. (가장 작은 풀의 크기) */
+    [[nodiscard]] usize size_hint() const noexcept
+    {
+        if (!(std::get<component_pool<Ts>*>(pools) && ...))
+        {
+            return 0;
+        }
+        return smallest_pool()->size();
+    }
+
+private:
+    [[nodiscard]] const internal::component_pool_base* smallest_pool() const noexcept
+    {
+        const internal::component_pool_base* lead = std::get<0>(pools);
+        ((lead = std::get<component_pool<Ts>*>(pools)->size() < lead->size() ? std::get<component_pool<Ts>*>(pools) : lead), ...);
+        return lead;
+    }
+
+    template <typename Fn, typename... Components>
+    static void invoke(Fn& fn, entity e, Components&... components)
+    {
+        if constexpr (std::is_invocable_v<Fn&, entity, Components&...>)
+        {
+            fn(e, components...);
+        }
+        else
+        {
+            fn(components...);
+        }
+    }
+
+private:
+    std::tuple<component_pool<Ts>*...> pools;
+};
+
+/**
+ * 엔티티 생성/파괴와 컴포넌트 풀을 관리하는 레지스트리
+ * 컴포넌트 풀은 sw::type_id로 키잉됩니다.
+ *
+ * @code
+ * sw::registry reg;
+ * sw::entity e = reg.create();
+ * reg.emplace<Position>(e, 0.0f, 0.0f);
+ * reg.emplace<Velocity>(e, 1.0f, 0.0f);
+ *
+ * reg.view<Position, Velocity>().each([](Position& p, const Velocity& v)
+ * {
+ *     p.x += v.x;
+ *     p.y += v.y;
+ * });
+ * @endcode
+ */
+class registry
+{
+public:
+    registry() = default;
+
+    registry(const registry&) = delete;
+    registry& operator=(const registry&) = delete;
+
+    registry(registry&&) noexcept = default;
+    registry& operator=(registry&&) noexcept = default;
+
+public:
+    /** 새 엔티티를 생성합니다. 파괴된 인덱스가 있으면 세대를 올려 재사용합니다. */
+    [[nodiscard]] entity create()
+    {
+        if (!free_indices.empty())
+        {
+            const u32 index = free_indices.back();
+            free_indices.pop_back();
+            return entity{ index, generations[index] };
+        }
+
+        const auto index = static_cast<u32>(generations.size());
+        generations.push_back(0);
+        return entity{ index, 0 };
+    }
+
+    /** 엔티티와 그 엔티티의 모든 컴포넌트를 파괴합니다. */
+    bool destroy(entity e)
+    {
+        if (!alive(e))
+        {
+            return false;
+        }
+
+        for (auto& [type, pool] : pools)
+        {
+            pool->remove(e);
+        }
+        ++generations[e.index];
+        free_indices.push_back(e.index);
+        return true;
+    }
+
+    /** 엔티티가 살아 있는지 확인합니다. (파괴 후 재사용된 핸들은 false) */
+    [[nodiscard]] bool alive(entity e) const noexcept
+    {
+        return e.index < generations.size() && generations[e.index] == e.generation;
+    }
+
+    /** 살아 있는 엔티티 수를 반환합니다. */
+    [[nodiscard]] usize size() const noexcept
+    {
+        return generations.size() - free_indices.size();
+    }
+
+public:
+    template <typename T, typename... Args>
+    T& emplace(entity e, Args&&... args)
+    {
+        return pool<T>().emplace(e, std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    bool remove(entity e)
+    {
+        auto* p = find_pool<T>();
+        return p && p->remove(e);
+    }
+
+    template <typename... Ts>
+    [[nodiscard]] bool has(entity e) const noexcept
+    {
+        return ((find_pool<Ts>() && find_pool<Ts>()->contains(e)) && ...);
+    }
+
+    template <typename T>
+    [[nodiscard]] T& get(entity e) noexcept
+    {
+        return find_pool<T>()->get(e);
+    }
+
+    template <typename T>
+    [[nodiscard]] T* try_get(entity e) noexcept
+    {
+        auto* p = find_pool<T>();
+        return p ? p->try_get(e) : nullptr;
+    }
+
+    /** 컴포넌트 T의 풀을 반환합니다. (없으면 생성) */
+    template <typename T>
+    component_pool<T>& pool()
+    {
+        auto [it, inserted] = pools.try_emplace(type_id::get<T>());
+        if (inserted)
+        {
+            it->second = std::make_unique<component_pool<T>>();
+        }
+        return static_cast<component_pool<T>&>(*it->second);
+    }
+
+    /** Ts를 모두 가진 엔티티를 순회하는 뷰를 반환합니다. */
+    template <typename... Ts>
+    [[nodiscard]] sw::view<Ts...> view()
+    {
+        return sw::view<Ts...>{ find_pool<Ts>()... };
+    }
+
+private:
+    template <typename T>
+    [[nodiscard]] component_pool<T>* find_pool() const noexcept
+    {
+        const auto it = pools.find(type_id::get<T>());
+        if (it == pools.end())
+        {
+            return nullptr;
+        }
+        return static_cast<component_pool<T>*>(it->second.get());
+    }
+
+private:
+    std::unordered_map<type_id, std::unique_ptr<internal::component_pool_base>> pools;
+    std::vector<u32> generations;
+    std::vector<u32> free_indices;
+};
+
+/**
+ * 같은 컴포넌트 조합(archetype)을 가진 엔티티들을 SoA(Structure of Arrays)로 저장하는 테이블
+ * 각 컴포넌트 컬럼은 ecs_column_alignment(64바이트)에 정렬된 연속 메모리로, SIMD 루프에 적합합니다.
+ *
+ * @code
+ * sw::archetype_table<Position, Velocity> table;
+ * table.emplace_back(e, Position{ 0, 0 }, Velocity{ 1, 0 });
+ *
+ * auto pos = table.column<Position>();
+ * auto vel = table.column<Velocity>();
+ * for (usize i = 0; i < table.size(); ++i) { pos[i].x += vel[i].x; }
+ * @endcode
+ */
+template <typename... Ts>
+    requires (sizeof...(Ts) > 0 && internal::types_are_unique<Ts...>)
+class archetype_table
+{
+public:
+    static constexpr usize column_alignment = internal::ecs_column_alignment;
+
+public:
+    archetype_table() = default;
+
+    ~archetype_table()
+    {
+        clear();
+        release(columns, row_capacity);
+    }
+
+    archetype_table(const archetype_table&) = delete;
+    archetype_table& operator=(const archetype_table&) = delete;
+
+    archetype_table(archetype_table&& other) noexcept
+        : columns(std::exchange(other.columns, {}))
+        , entity_list(std::move(other.entity_list))
+        , row_count(std::exchange(other.row_count, 0))
+        , row_capacity(std::exchange(other.row_capacity, 0))
+    {
+    }
+
+    archetype_table& operator=(archetype_table&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            release(columns, row_capacity);
+            columns = std::exchange(other.columns, {});
+            entity_list = std::move(other.entity_list);
+            row_count = std::exchange(other.row_count, 0);
+            row_capacity = std::exchange(other.row_capacity, 0);
+        }
+        return *this;
+    }
+
+public:
+    /** 엔티티 한 행(row)을 추가하고 행 번호를 반환합니다. 인자는 Ts... 순서를 따릅니다. */
+    template <typename... Args>
+        requires (sizeof...(Args) == sizeof...(Ts))
+    usize emplace_back(entity e, Args&&... args)
+    {
+        if (row_count < row_capacity)
+        {
+            construct_row(columns, row_count, std::forward<Args>(args)...);
+        }
+        else
+        {
+            // args가 기존 컬럼을 가리킬 수 있으므로 새 컬럼에 행을 먼저 생성한 뒤 옮김
+            const usize new_capacity = row_capacity == 0 ? 16 : row_capacity * 2;
+            std::tuple<Ts*...> new_columns{ allocate_column<Ts>(new_capacity)... };
+            try
+            {
+                entity_list.reserve(new_capacity);
+                construct_row(new_columns, row_count, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                release(new_columns, new_capacity);
+                throw;
+            }
+
+            (relocate_column(std::get<Ts*>(columns), std::get<Ts*>(new_columns), row_count), ...);
+            release(columns, row_capacity);
+            columns = new_columns;
+            row_capacity = new_capacity;
+        }
+
+        // 용량은 reserve에서 확보되어 있으므로 던지지 않음
+        entity_list.push_back(e);
+        return row_count++;
+    }
+
+    /**
+     * row 행을 마지막 행과 교체한 뒤 제거합니다. (swap-and-pop)
+     * @return row 위치로 옮겨진 엔티티 (마지막 행을 지웠으면 null_entity)
+     */
+    entity erase(usize row) noexcept
+    {
+        const usize last = row_count - 1;
+        entity moved = null_entity;
+        if (row != last)
+        {
+            ((std::get<Ts*>(columns)[row] = std::move(std::get<Ts*>(columns)[last])), ...);
+            entity_list[row] = entity_list[last];
+            moved = entity_list[row];
+        }
+        (std::destroy_at(std::get<Ts*>(columns) + last), ...);
+        entity_list.pop_back();
+        --row_count;
+        return moved;
+    }
+
+    void reserve(usize new_capacity)
+    {
+        if (new_capacity <= row_capacity)
+        {
+            return;
+        }
+
+        std::tuple<Ts*...> new_columns{ allocate_column<Ts>(new_capacity)... };
+        (relocate_column(std::get<Ts*>(columns), std::get<Ts*>(new_columns), row_count), ...);
+        release(columns, row_capacity);
+
+        columns = new_columns;
+        row_capacity = new_capacity;
+        entity_list.reserve(new_capacity);
+    }
+
+    void clear() noexcept
+    {
+        (std::destroy_n(std::get<Ts*>(columns), row_count), ...);
+        entity_list.clear();
+        row_count = 0;
+    }
+
+public:
+    [[nodiscard]] usize size() const noexcept { return row_count; }
+    [[nodiscard]] usize capacity() const noexcept { return row_capacity; }
+    [[nodiscard]] bool empty() const noexcept { return row_count == 0; }
+
+    /** 컴포넌트 T의 연속된 컬럼을 반환합니다. */
+    template <typename T>
+    [[nodiscard]] std::span<T> column() noexcept
+    {
+        return { std::get<T*>(columns), row_count };
+    }
+
+    template <typename T>
+    [[nodiscard]] std::span<const T> column() const noexcept
+    {
+        return { std::get<T*>(columns), row_count };
+    }
+
+    template <typename T>
+    [[nodiscard]] T& get(usize row) noexcept
+    {
+        return std::get<T*>(columns)[row];
+    }
+
+    [[nodiscard]] std::span<const entity> entities() const noexcept { return entity_list; }
+
+private:
+    template <typename T>
+    static T* allocate_column(usize count)
+    {
+        // 컬럼 끝까지 정렬 단위로 올려 SIMD 루프가 꼬리(tail)까지 안전하게 읽을 수 있도록 함
+        const usize bytes = aligned_size(count * sizeof(T), column_alignment);
+        return static_cast<T*>(::operator new(bytes, std::align_val_t{ column_alignment }));
+    }
+
+    /** row 위치에 한 행을 생성합니다. 중간에 던지면 이미 생성한 컬럼 값을 파괴합니다. */
+    template <typename... Args>
+    static void construct_row(std::tuple<Ts*...>& cols, usize row, Args&&... args)
+    {
+        usize constructed = 0;
+        try
+        {
+            ((std::construct_at(std::get<Ts*>(cols) + row, std::forward<Args>(args)), ++constructed), ...);
+        }
+        catch (...)
+        {
+            usize index = 0;
+            ((index++ < constructed ? std::destroy_at(std::get<Ts*>(cols) + row) : void()), ...);
+            throw;
+        }
+    }
+
+    template <typename T>
+    static void relocate_column(T* src, T* dst, usize count) noexcept
+    {
+        uninitialized_relocate_n(src, count, dst);
+    }
+
+    static void release(std::tuple<Ts*...>& cols, usize capacity) noexcept
+    {
+        if (capacity == 0)
+        {
+            return;
+        }
+        (::operator delete(std::get<Ts*>(cols), aligned_size(capacity * sizeof(Ts), column_alignment), std::align_val_t{ column_alignment }), ...);
+        cols = {};
+    }
+
+private:
+    std::tuple<Ts*...> columns{};
+    std::vector<entity> entity_list;
+    usize row_count = 0;
+    usize row_capacity = 0;
+};
+} // namespace sw
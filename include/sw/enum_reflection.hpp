@@ -0,0 +1,451 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/hash.hpp"
+#include "sw/type_signature.hpp"
+
+
+namespace sw
+{
+/**
+ * 열거자를 찾을 값 범위 (포함 구간)
+ * 범위 안의 값마다 템플릿을 하나씩 인스턴스화하므로, 범위 밖의 값을 쓰는 열거형은 특수화해서 넓힙니다.
+ *
+ * @code
+ * template <>
+ * struct sw::enum_range<http_status> { static constexpr i64 min = 100; static constexpr i64 max = 599; };
+ * @endcode
+ */
+template <typename E>
+struct enum_range
+{
+    static constexpr i64 min = -128;
+    static constexpr i64 max = 127;
+};
+
+/**
+ * 반영(reflection) 가능한 열거형
+ * 기반 타입이 고정되지 않은 unscoped enum은 범위 밖 값으로의 변환이 상수식에서 허용되지 않으므로 제외합니다.
+ */
+template <typename E>
+concept reflectable_enum = std::is_enum_v<E> && requires { E{ std::underlying_type_t<E>{} }; };
+
+namespace internal
+{
+/** 열거자 값 V가 들어간 컴파일러 시그니처 */
+template <auto V>
+consteval std::string_view get_raw_enum_signature() noexcept
+{
+#if SW_COMPILER_MSVC
+    return __FUNCSIG__;
+#elif SW_COMPILER_CLANG || SW_COMPILER_GCC
+    return __PRETTY_FUNCTION__;
+#else
+#error "Unsupported compiler for enum name extraction"
+#endif
+}
+
+/**
+ * 시그니처에서 열거자 이름을 추출합니다.
+ * 이름이 없는 값은 "(Color)5", "(enum Color)0x5"처럼 캐스트 형태로 출력되므로 빈 문자열을 반환합니다.
+ */
+consteval std::string_view extract_enum_value_name(std::string_view signature) noexcept
+{
+#if SW_COMPILER_MSVC
+    constexpr std::string_view prefix = "get_raw_enum_signature<";
+    constexpr std::string_view terminators = ">";
+#elif SW_COMPILER_CLANG
+    constexpr std::string_view prefix = "[V = ";
+    constexpr std::string_view terminators = ";]";
+#else
+    constexpr std::string_view prefix = "[with auto V = ";
+    constexpr std::string_view terminators = ";]";
+#endif
+    usize start_pos = signature.find(prefix);
+    if (start_pos == std::string_view::npos)
+    {
+        return {};
+    }
+    start_pos += prefix.size();
+
+    const usize end_pos = signature.find_first_of(terminators, start_pos);
+    if (end_pos == std::string_view::npos)
+    {
+        return {};
+    }
+
+    const std::string_view value = trim_whitespace(signature.substr(start_pos, end_pos - start_pos));
+    if (value.empty())
+    {
+        return {};
+    }
+
+    // 캐스트 형태의 "(proto::color)5"에도 ::가 있으므로 namespace 제거 전에 확인
+    const char first = value.front();
+    const bool identifier = (first >= 'a' && first <= 'z') || (first >= 'A' && first <= 'Z') || first == '_';
+    return identifier ? remove_namespace(value) : std::string_view{};
+}
+
+template <auto V>
+consteval std::string_view enum_value_name() noexcept
+{
+    return extract_enum_value_name(get_raw_enum_signature<V>());
+}
+
+/** enum_range를 기반 타입의 표현 범위로 자른 탐색 구간 */
+template <typename E>
+consteval i64 enum_probe_min() noexcept
+{
+    using underlying = std::underlying_type_t<E>;
+    if constexpr (std::is_same_v<underlying, bool>)
+    {
+        return 0;
+    }
+    else
+    {
+        return std::max<i64>(enum_range<E>::min, static_cast<i64>(std::numeric_limits<underlying>::min()));
+    }
+}
+
+template <typename E>
+consteval i64 enum_probe_max() noexcept
+{
+    using underlying = std::underlying_type_t<E>;
+    if constexpr (std::is_same_v<underlying, bool>)
+    {
+        return 1;
+    }
+    else
+    {
+        constexpr auto max = std::numeric_limits<underlying>::max();
+        if constexpr (static_cast<u64>(max) > static_cast<u64>(std::numeric_limits<i64>::max()))
+        {
+            return enum_range<E>::max;
+        }
+        else
+        {
+            return std::min<i64>(enum_range<E>::max, static_cast<i64>(max));
+        }
+    }
+}
+
+template <typename E, i64 Min, i64... I>
+consteval std::array<std::string_view, sizeof...(I)> probe_enum_names(std::integer_sequence<i64, I...>) noexcept
+{
+    return { enum_value_name<static_cast<E>(Min + I)>()... };
+}
+
+/** 탐색 구간의 모든 값에 대한 이름 (이름이 없으면 빈 문자열) */
+template <typename E>
+consteval auto probe_enum_names() noexcept
+{
+    constexpr i64 min = enum_probe_min<E>();
+    constexpr i64 max = enum_probe_max<E>();
+    static_assert(min <= max, "enum_range<E> is empty");
+    return probe_enum_names<E, min>(std::make_integer_sequence<i64, max - min + 1>{});
+}
+
+/** perfect hash 슬롯 계산 (fnv1a 결과와 버킷별 seed를 섞음) */
+[[nodiscard]] constexpr u64 enum_hash_mix(u64 hash, u64 seed) noexcept
+{
+    u64 x = hash ^ (seed * 0x9E3779B97F4A7C15ULL);
+    x ^= x >> 31;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 29;
+    return x;
+}
+
+/**
+ * 열거형 E의 컴파일 타임 테이블
+ * 이름은 시그니처 리터럴이 아니라 하나로 이어 붙인 문자 배열에 담아, 바이너리에는 이름만 남습니다.
+ */
+template <typename E>
+struct enum_table
+{
+    using index_type = u16;
+    static constexpr index_type npos = std::numeric_limits<index_type>::max();
+
+    static constexpr i64 probe_min = enum_probe_min<E>();
+
+    static constexpr usize count = []
+    {
+        usize result = 0;
+        for (const std::string_view name : probe_enum_names<E>())
+        {
+            result += name.empty() ? 0 : 1;
+        }
+        return result;
+    }();
+    static_assert(count < npos, "too many enumerators");
+
+    static constexpr usize chars_size = []
+    {
+        usize result = 0;
+        for (const std::string_view name : probe_enum_names<E>())
+        {
+            result += name.size();
+        }
+        return result;
+    }();
+
+    /** 값 오름차순 열거자 */
+    static constexpr std::array<E, count> values = []
+    {
+        std::array<E, count> result{};
+        usize index = 0;
+        const auto names = probe_enum_names<E>();
+        for (usize i = 0; i < names.size(); ++i)
+        {
+            if (!names[i].empty())
+            {
+                result[index++] = static_cast<E>(probe_min + static_cast<i64>(i));
+            }
+        }
+        return result;
+    }();
+
+    /** 모든 이름을 이어 붙인 문자 배열과 각 이름의 시작 위치 (values와 같은 순서) */
+    static constexpr std::array<char, chars_size> chars = []
+    {
+        std::array<char, chars_size> result{};
+        usize offset = 0;
+        for (const std::string_view name : probe_enum_names<E>())
+        {
+            for (const char c : name)
+            {
+                result[offset++] = c;
+            }
+        }
+        return result;
+    }();
+
+    static constexpr std::array<u32, count + 1> offsets = []
+    {
+        std::array<u32, count + 1> result{};
+        usize index = 0;
+        u32 offset = 0;
+        for (const std::string_view name : probe_enum_names<E>())
+        {
+            if (!name.empty())
+            {
+                result[index++] = offset;
+                offset += static_cast<u32>(name.size());
+            }
+        }
+        result[index] = offset;
+        return result;
+    }();
+
+    [[nodiscard]] static constexpr std::string_view name(usize index) noexcept
+    {
+        return std::string_view{ chars.data() + offsets[index], offsets[index + 1] - offsets[index] };
+    }
+
+    static constexpr i64 first_value = count ? static_cast<i64>(std::to_underlying(values.front())) : 0;
+    static constexpr i64 last_value = count ? static_cast<i64>(std::to_underlying(values.back())) : -1;
+
+    /** (값 - first_value) → values 인덱스 (이름 없는 값은 npos) */
+    static constexpr std::array<index_type, static_cast<usize>(last_value - first_value + 1)> value_index = []
+    {
+        std::array<index_type, static_cast<usize>(last_value - first_value + 1)> result{};
+        result.fill(npos);
+        for (usize i = 0; i < count; ++i)
+        {
+            result[static_cast<usize>(static_cast<i64>(std::to_underlying(values[i])) - first_value)] = static_cast<index_type>(i);
+        }
+        return result;
+    }();
+
+    // perfect hash: 버킷마다 충돌 없는 seed를 찾는 hash-and-displace, 부하율 0.5 이하
+    static constexpr usize bucket_count = std::bit_ceil(std::max<usize>(count, 1));
+    static constexpr usize slot_count = bucket_count * 2;
+
+    [[nodiscard]] static constexpr usize bucket_of(u64 hash) noexcept
+    {
+        return static_cast<usize>(hash >> 32) & (bucket_count - 1);
+    }
+
+    [[nodiscard]] static constexpr usize slot_of(u64 hash, u32 seed) noexcept
+    {
+        return static_cast<usize>(enum_hash_mix(hash, seed)) & (slot_count - 1);
+    }
+
+    struct perfect_hash
+    {
+        std::array<u32, bucket_count> seeds{};
+        std::array<index_type, slot_count> slots{};
+    };
+
+    static constexpr perfect_hash hash_table = []
+    {
+        perfect_hash result{};
+        result.slots.fill(npos);
+
+        std::array<u64, count> hashes{};
+        std::array<usize, bucket_count> bucket_sizes{};
+        for (usize i = 0; i < count; ++i)
+        {
+            hashes[i] = fnv1a(name(i));
+            ++bucket_sizes[bucket_of(hashes[i])];
+        }
+
+        // 큰 버킷부터 배치해야 빈 슬롯이 많을 때 어려운 버킷을 처리할 수 있음
+        const usize largest = count ? *std::max_element(bucket_sizes.begin(), bucket_sizes.end()) : 0;
+        for (usize size = largest; size > 0; --size)
+        {
+            for (usize bucket = 0; bucket < bucket_count; ++bucket)
+            {
+                if (bucket_sizes[bucket] != size)
+                {
+                    continue;
+                }
+
+                for (u32 seed = 0;; ++seed)
+                {
+                    std::array<usize, count> placed{};
+                    usize placed_count = 0;
+                    bool ok = true;
+                    for (usize i = 0; i < count && ok; ++i)
+                    {
+                        if (bucket_of(hashes[i]) != bucket)
+                        {
+                            continue;
+                        }
+                        const usize slot = slot_of(hashes[i], seed);
+                        ok = result.slots[slot] == npos;
+                        for (usize j = 0; j < placed_count && ok; ++j)
+                        {
+                            ok = placed[j] != slot;
+                        }
+                        placed[placed_count++] = slot;
+                    }
+
+                    if (ok)
+                    {
+                        for (usize i = 0; i < count; ++i)
+                        {
+                            if (bucket_of(hashes[i]) == bucket)
+                            {
+                                result.slots[slot_of(hashes[i], seed)] = static_cast<index_type>(i);
+                            }
+                        }
+                        result.seeds[bucket] = seed;
+                        break;
+                    }
+                }
+            }
+        }
+        return result;
+    }();
+
+    /** values 인덱스 → 이름 배열 (chars를 가리킴) */
+    static constexpr std::array<std::string_view, count> names = []
+    {
+        std::array<std::string_view, count> result{};
+        for (usize i = 0; i < count; ++i)
+        {
+            result[i] = name(i);
+        }
+        return result;
+    }();
+};
+} // namespace internal
+
+/** 열거자 개수 */
+template <reflectable_enum E>
+[[nodiscard]] constexpr usize enum_count() noexcept
+{
+    return internal::enum_table<E>::count;
+}
+
+/** 값 오름차순의 모든 열거자 */
+template <reflectable_enum E>
+[[nodiscard]] constexpr const std::array<E, internal::enum_table<E>::count>& enum_values() noexcept
+{
+    return internal::enum_table<E>::values;
+}
+
+/** enum_values()와 같은 순서의 열거자 이름 */
+template <reflectable_enum E>
+[[nodiscard]] constexpr const std::array<std::string_view, internal::enum_table<E>::count>& enum_names() noexcept
+{
+    return internal::enum_table<E>::names;
+}
+
+/**
+ * 열거자 이름 (배열 인덱스 한 번으로 조회)
+ * @return 이름, 이름이 없는 값이거나 enum_range 밖이면 빈 문자열
+ */
+template <reflectable_enum E>
+[[nodiscard]] constexpr std::string_view enum_name(E value) noexcept
+{
+    using table = internal::enum_table<E>;
+
+    const auto raw = static_cast<i64>(std::to_underlying(value));
+    if (raw < table::first_value || raw > table::last_value)
+    {
+        return {};
+    }
+
+    const auto index = table::value_index[static_cast<usize>(raw - table::first_value)];
+    return index == table::npos ? std::string_view{} : table::name(index);
+}
+
+/**
+ * 이름으로 열거자를 찾습니다. (fnv1a 한 번 + perfect hash 슬롯 하나 비교)
+ * @return 이름이 정확히 일치하는 열거자, 없으면 std::nullopt
+ */
+template <reflectable_enum E>
+[[nodiscard]] constexpr std::optional<E> enum_cast(std::string_view name) noexcept
+{
+    using table = internal::enum_table<E>;
+    if constexpr (table::count == 0)
+    {
+        return std::nullopt;
+    }
+    else
+    {
+        const u64 hash = fnv1a(name);
+        const u32 seed = table::hash_table.seeds[table::bucket_of(hash)];
+        const auto index = table::hash_table.slots[table::slot_of(hash, seed)];
+        if (index == table::npos || table::name(index) != name)
+        {
+            return std::nullopt;
+        }
+        return table::values[index];
+    }
+}
+
+/**
+ * 정수 값을 열거자로 변환합니다.
+ * @return 이름이 있는 값이면 해당 열거자, 아니면 std::nullopt
+ */
+template <reflectable_enum E, std::integral Integer>
+[[nodiscard]] constexpr std::optional<E> enum_cast(Integer value) noexcept
+{
+    using table = internal::enum_table<E>;
+
+    if (!std::in_range<i64>(value))
+    {
+        return std::nullopt;
+    }
+    const auto raw = static_cast<i64>(value);
+    if (raw < table::first_value || raw > table::last_value
+        || table::value_index[static_cast<usize>(raw - table::first_value)] == table::npos)
+    {
+        return std::nullopt;
+    }
+    return static_cast<E>(value);
+}
+} // namespace sw
@@ -0,0 +1,307 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "sw/types.hpp"
+#include "sw/function.hpp"
+#include "sw/type_id.hpp"
+
+
+namespace sw
+{
+/** event_bus::subscribe가 반환하는 구독 핸들 */
+struct event_handle
+{
+    type_id type;
+    u64 id = 0;
+
+    [[nodiscard]] constexpr bool is_valid() const noexcept { return id != 0; }
+    [[nodiscard]] explicit constexpr operator bool() const noexcept { return is_valid(); }
+    [[nodiscard]] constexpr bool operator==(const event_handle&) const = default;
+};
+
+namespace internal
+{
+/** 이벤트 타입별 채널의 공통 인터페이스 */
+struct event_channel_base
+{
+    virtual ~event_channel_base() = default;
+    virtual bool unsubscribe(u64 id) noexcept = 0;
+    virtual void dispatch() = 0;
+    virtual void clear_queue() noexcept = 0;
+    virtual usize pending() const noexcept = 0;
+};
+
+/**
+ * 이벤트 타입 E에 대한 핸들러 목록과 대기열
+ * 대기열은 E 타입끼리 연속된 배열에 쌓이고, 한 핸들러가 모든 이벤트를 처리한 뒤 다음 핸들러로 넘어갑니다.
+ */
+template <typename E>
+struct event_channel final : event_channel_base
+{
+    struct handler_entry
+    {
+        u64 id;
+        function<void(const E&)> callback;
+    };
+
+    std::vector<handler_entry> handlers;
+    std::vector<handler_entry> deferred_handlers;  // dispatch 중에 등록된 핸들러
+    std::vector<E> queue;
+    std::vector<E> batch;  // dispatch 중인 이벤트 (용량 재사용)
+    u32 dispatch_depth = 0;
+    bool needs_compact = false;
+
+    void subscribe(u64 id, function<void(const E&)>&& callback)
+    {
+        // 순회 중에 handlers가 재할당되지 않도록 dispatch가 끝난 뒤 합침
+        auto& target = (dispatch_depth > 0) ? deferred_handlers : handlers;
+        target.push_back({ id, std::move(callback) });
+    }
+
+    void publish(const E& event)
+    {
+        ++dispatch_depth;
+        for (const auto& handler : handlers)
+        {
+            if (handler.callback)
+            {
+                handler.callback(event);
+            }
+        }
+        end_dispatch();
+    }
+
+    virtual bool unsubscribe(u64 id) noexcept override
+    {
+        const auto deferred = std::ranges::find(deferred_handlers, id, &handler_entry::id);
+        if (deferred != deferred_handlers.end())
+        {
+            deferred_handlers.erase(deferred);
+            return true;
+        }
+
+        const auto it = std::ranges::find(handlers, id, &handler_entry::id);
+        if (it == handlers.end() || !it->callback)
+        {
+            return false;
+        }
+
+        if (dispatch_depth > 0)
+        {
+            // 순회 중에는 비워두기만 하고 dispatch가 끝난 뒤 정리
+            it->callback = nullptr;
+            needs_compact = true;
+        }
+        else
+        {
+            handlers.erase(it);
+        }
+        return true;
+    }
+
+    virtual void dispatch() override
+    {
+        if (queue.empty() || dispatch_depth > 0)
+        {
+            return;
+        }
+
+        // 핸들러 안에서 enqueue된 이벤트는 다음 dispatch로 넘어가도록 대기열을 교체
+        batch.swap(queue);
+
+        ++dispatch_depth;
+        for (const auto& handler : handlers)
+        {
+            for (const E& event : batch)
+            {
+                // 핸들러 안에서 자기 자신이 해제되었으면 중단
+                if (!handler.callback)
+                {
+                    break;
+                }
+                handler.callback(event);
+            }
+        }
+        end_dispatch();
+
+        batch.clear();
+    }
+
+    virtual void clear_queue() noexcept override
+    {
+        queue.clear();
+    }
+
+    virtual usize pending() const noexcept override
+    {
+        return queue.size();
+    }
+
+    void end_dispatch()
+    {
+        if (--dispatch_depth > 0)
+        {
+            return;
+        }
+
+        if (needs_compact)
+        {
+            std::erase_if(handlers, [](const handler_entry& entry) { return !entry.callback; });
+            needs_compact = false;
+        }
+
+        if (!deferred_handlers.empty())
+        {
+            std::ranges::move(deferred_handlers, std::back_inserter(handlers));
+            deferred_handlers.clear();
+        }
+    }
+};
+} // namespace internal
+
+/**
+ * sw::type_id로 키잉되는 이벤트 버스
+ * 즉시 전달(publish)과 대기열 전달(enqueue + dispatch)을 모두 지원합니다.
+ *
+ * @code
+ * sw::event_bus bus;
+ * auto handle = bus.subscribe<DamageEvent>([](const DamageEvent& e) { ... });
+ *
+ * bus.publish(DamageEvent{ 10 });  // 즉시 전달
+ * bus.enqueue(DamageEvent{ 20 });  // 대기열에 저장
+ * bus.dispatch();                  // 타입별로 모아서 일괄 전달
+ *
+ * bus.unsubscribe(handle);
+ * @endcode
+ */
+class event_bus
+{
+public:
+    event_bus() = default;
+    ~event_bus() = default;
+
+    event_bus(const event_bus&) = delete;
+    event_bus& operator=(const event_bus&) = delete;
+
+    event_bus(event_bus&&) noexcept = default;
+    event_bus& operator=(event_bus&&) noexcept = default;
+
+public:
+    /** 이벤트 E에 대한 핸들러를 등록합니다. */
+    template <typename E>
+    event_handle subscribe(function<void(const E&)> handler)
+    {
+        const u64 id = ++last_handler_id;
+        get_or_create_channel<E>().subscribe(id, std::move(handler));
+        return event_handle{ type_id::get<E>(), id };
+    }
+
+    /** 등록된 핸들러를 해제합니다. */
+    bool unsubscribe(const event_handle& handle) noexcept
+    {
+        const auto it = channels.find(handle.type);
+        if (it == channels.end())
+        {
+            return false;
+        }
+        return it->second->unsubscribe(handle.id);
+    }
+
+    /** 이벤트를 등록된 모든 핸들러에 즉시 전달합니다. */
+    template <typename E>
+    void publish(const E& event)
+    {
+        if (auto* channel = find_channel<E>())
+        {
+            channel->publish(event);
+        }
+    }
+
+    /** 이벤트를 타입별 대기열에 저장합니다. dispatch() 호출 시 전달됩니다. */
+    template <typename E>
+    void enqueue(E&& event)
+    {
+        using event_type = std::remove_cvref_t<E>;
+        get_or_create_channel<event_type>().queue.push_back(std::forward<E>(event));
+    }
+
+    /** 이벤트를 타입별 대기열에 제자리에서(in-place) 생성합니다. */
+    template <typename E, typename... Args>
+    E& emplace(Args&&... args)
+    {
+        return get_or_create_channel<E>().queue.emplace_back(std::forward<Args>(args)...);
+    }
+
+    /** 이벤트 E의 대기열을 일괄 전달합니다. */
+    template <typename E>
+    void dispatch()
+    {
+        if (auto* channel = find_channel<E>())
+        {
+            channel->dispatch();
+        }
+    }
+
+    /** 모든 대기열을 등록 순서대로 일괄 전달합니다. */
+    void dispatch()
+    {
+        // 핸들러 안에서 새 채널이 생길 수 있으므로 인덱스로 순회
+        for (usize i = 0; i < channel_order.size(); ++i)
+        {
+            channel_order[i]->dispatch();
+        }
+    }
+
+    /** 이벤트 E의 대기 중인 이벤트 수를 반환합니다. */
+    template <typename E>
+    [[nodiscard]] usize pending() const noexcept
+    {
+        const auto it = channels.find(type_id::get<E>());
+        return it != channels.end() ? it->second->pending() : 0;
+    }
+
+    /** 모든 대기열을 전달하지 않고 비웁니다. */
+    void clear_queues() noexcept
+    {
+        for (auto* channel : channel_order)
+        {
+            channel->clear_queue();
+        }
+    }
+
+private:
+    template <typename E>
+    [[nodiscard]] internal::event_channel<E>* find_channel() noexcept
+    {
+        const auto it = channels.find(type_id::get<E>());
+        if (it == channels.end())
+        {
+            return nullptr;
+        }
+        return static_cast<internal::event_channel<E>*>(it->second.get());
+    }
+
+    template <typename E>
+    internal::event_channel<E>& get_or_create_channel()
+    {
+        auto [it, inserted] = channels.try_emplace(type_id::get<E>());
+        if (inserted)
+        {
+            it->second = std::make_unique<internal::event_channel<E>>();
+            channel_order.push_back(it->second.get());
+        }
+        return static_cast<internal::event_channel<E>&>(*it->second);
+    }
+
+private:
+    std::unordered_map<type_id, std::unique_ptr<internal::event_channel_base>> channels;
+    std::vector<internal::event_channel_base*> channel_order;
+    u64 last_handler_id = 0;
+};
+} // namespace sw
@@ -0,0 +1,497 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <new>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/memory.hpp"
+#include "sw/virtual_arena.hpp"
+
+
+namespace sw
+{
+/** 파일 접근 권한 */
+enum class file_access : u8
+{
+    read_only,
+    read_write,
+};
+
+/** 매핑한 범위를 어떻게 읽을지에 대한 OS 힌트 (Linux/macOS: madvise, Windows: PrefetchVirtualMemory) */
+enum class access_pattern : u8
+{
+    normal,
+    sequential, // 앞에서부터 한 번 훑음: 미리 읽기를 늘리고 읽은 페이지를 빨리 회수
+    random,     // 임의 위치 접근: 미리 읽기를 끔
+    will_need,  // 곧 전체를 읽음: 지금 미리 읽어 둠
+};
+
+namespace internal
+{
+// 플랫폼별 구현은 src/file.cpp에 있음 (POSIX: open/pread/mmap, Windows: CreateFile/ReadFile/MapViewOfFile)
+// 파일 핸들은 POSIX fd 또는 Windows HANDLE을 정수로 담으며, 실패 시 invalid_file
+inline constexpr isize invalid_file = -1;
+
+/** 마지막 I/O 오류 (errno 또는 GetLastError) */
+[[nodiscard]] std::error_code last_file_error() noexcept;
+
+[[nodiscard]] isize file_open(const std::filesystem::path& path, file_access access, bool create) noexcept;
+void file_close(isize file) noexcept;
+[[nodiscard]] bool file_size(isize file, u64& size) noexcept;
+[[nodiscard]] bool file_resize(isize file, u64 size) noexcept;
+
+/** offset 위치에서 최대 size 바이트를 읽습니다. (짧게 읽히면 반복, 파일 끝이면 그만큼만) @return 읽은 바이트 수, 실패 시 -1 */
+[[nodiscard]] isize file_read_at(isize file, void* buffer, usize size, u64 offset) noexcept;
+
+/** 순차 읽기 힌트 (posix_fadvise) */
+void file_advise_sequential(isize file) noexcept;
+
+struct file_mapping
+{
+    void* address = nullptr;
+    usize size = 0;
+    isize native = invalid_file; // Windows 매핑 객체 핸들
+};
+
+[[nodiscard]] file_mapping file_map(isize file, usize size, file_access access) noexcept;
+void file_unmap(const file_mapping& mapping) noexcept;
+void file_advise(void* address, usize size, access_pattern pattern) noexcept;
+[[nodiscard]] bool file_flush(void* address, usize size) noexcept;
+
+/** 파일 핸들 소유 (이동 전용) */
+class file_handle
+{
+public:
+    file_handle() noexcept = default;
+
+    explicit file_handle(isize native) noexcept
+        : native(native)
+    {
+    }
+
+    file_handle(file_handle&& other) noexcept
+        : native(std::exchange(other.native, invalid_file))
+    {
+    }
+
+    file_handle& operator=(file_handle&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            native = std::exchange(other.native, invalid_file);
+        }
+        return *this;
+    }
+
+    ~file_handle()
+    {
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        if (native != invalid_file)
+        {
+            file_close(native);
+            native = invalid_file;
+        }
+    }
+
+    [[nodiscard]] isize get() const noexcept { return native; }
+    [[nodiscard]] bool is_open() const noexcept { return native != invalid_file; }
+
+private:
+    isize native = invalid_file;
+};
+
+[[nodiscard]] inline file_handle open_file_or_throw(const std::filesystem::path& path, file_access access, bool create, const char* what)
+{
+    file_handle file{ file_open(path, access, create) };
+    if (!file.is_open())
+    {
+        throw std::system_error(last_file_error(), what);
+    }
+    return file;
+}
+} // namespace internal
+
+/**
+ * 메모리 매핑한 파일
+ * 파일 내용을 주소 공간에 그대로 올려 std::span<const std::byte>로 노출하므로, 해시/파싱/역직렬화(sw::flat_view)를
+ * 복사 없이 파일 위에서 바로 실행할 수 있습니다. 주소 공간에 다 올리기 어려운 큰 파일은 chunked_reader를 사용합니다.
+ *
+ * @code
+ * sw::mapped_file file{ "snapshot.bin", sw::file_access::read_only, sw::access_pattern::sequential };
+ * sw::flat_view<snapshot> view{ file.bytes() };
+ * @endcode
+ */
+class mapped_file
+{
+public:
+    mapped_file() noexcept = default;
+
+    /**
+     * 기존 파일을 매핑합니다. (빈 파일은 빈 span)
+     * @throw std::system_error 열기나 매핑에 실패한 경우
+     */
+    explicit mapped_file(const std::filesystem::path& path, file_access access = file_access::read_only, access_pattern pattern = access_pattern::normal)
+        : access(access)
+    {
+        open(internal::open_file_or_throw(path, access, false, "mapped_file: open"), pattern);
+    }
+
+    /**
+     * size 바이트 크기의 파일을 만들거나 크기를 맞춘 뒤 읽기/쓰기로 매핑합니다.
+     * @throw std::system_error 생성, 크기 변경, 매핑에 실패한 경우
+     */
+    [[nodiscard]] static mapped_file create(const std::filesystem::path& path, u64 size, access_pattern pattern = access_pattern::normal)
+    {
+        internal::file_handle file = internal::open_file_or_throw(path, file_access::read_write, true, "mapped_file: create");
+        if (!internal::file_resize(file.get(), size))
+        {
+            throw std::system_error(internal::last_file_error(), "mapped_file: resize");
+        }
+
+        mapped_file result;
+        result.access = file_access::read_write;
+        result.open(std::move(file), pattern);
+        return result;
+    }
+
+    mapped_file(mapped_file&& other) noexcept
+        : file(std::move(other.file))
+        , mapping(std::exchange(other.mapping, {}))
+        , access(other.access)
+    {
+    }
+
+    mapped_file& operator=(mapped_file&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            file = std::move(other.file);
+            mapping = std::exchange(other.mapping, {});
+            access = other.access;
+        }
+        return *this;
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    ~mapped_file()
+    {
+        close();
+    }
+
+    /** 매핑을 해제하고 파일을 닫습니다. (쓰기 내용은 OS가 파일에 반영) */
+    void close() noexcept
+    {
+        if (mapping.address)
+        {
+            internal::file_unmap(mapping);
+            mapping = {};
+        }
+        file.reset();
+    }
+
+public:
+    /** 파일 전체 */
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept
+    {
+        return { static_cast<const std::byte*>(mapping.address), mapping.size };
+    }
+
+    /** 파일 전체 (read_write로 연 경우만) */
+    [[nodiscard]] std::span<std::byte> writable_bytes() noexcept
+    {
+        assert(access == file_access::read_write && "mapped_file is read-only");
+        return { static_cast<std::byte*>(mapping.address), mapping.size };
+    }
+
+    /** 전체 범위의 접근 방식 힌트를 바꿉니다. */
+    void advise(access_pattern pattern) noexcept
+    {
+        advise(pattern, 0, mapping.size);
+    }
+
+    /** [offset, offset + size) 범위의 접근 방식 힌트 (페이지 경계로 넓혀 적용) */
+    void advise(access_pattern pattern, usize offset, usize size) noexcept
+    {
+        if (!mapping.address || offset >= mapping.size)
+        {
+            return;
+        }
+
+        const usize page = page_size();
+        const usize begin = offset & ~(page - 1);
+        const usize end = std::min(aligned_size(offset + std::min(size, mapping.size - offset), page), aligned_size(mapping.size, page));
+        internal::file_advise(static_cast<std::byte*>(mapping.address) + begin, end - begin, pattern);
+    }
+
+    /**
+     * 수정한 페이지를 파일에 기록할 때까지 기다립니다. (msync / FlushViewOfFile)
+     * @throw std::system_error 기록에 실패한 경우
+     */
+    void flush()
+    {
+        if (mapping.address && access == file_access::read_write && !internal::file_flush(mapping.address, mapping.size))
+        {
+            throw std::system_error(internal::last_file_error(), "mapped_file: flush");
+        }
+    }
+
+    [[nodiscard]] usize size() const noexcept { return mapping.size; }
+    [[nodiscard]] bool empty() const noexcept { return mapping.size == 0; }
+    [[nodiscard]] bool is_open() const noexcept { return file.is_open(); }
+    [[nodiscard]] bool is_writable() const noexcept { return access == file_access::read_write; }
+
+private:
+    void open(internal::file_handle&& handle, access_pattern pattern)
+    {
+        u64 file_size = 0;
+        if (!internal::file_size(handle.get(), file_size))
+        {
+            throw std::system_error(internal::last_file_error(), "mapped_file: size");
+        }
+
+        if (file_size > 0)
+        {
+            mapping = internal::file_map(handle.get(), static_cast<usize>(file_size), access);
+            if (!mapping.address)
+            {
+                throw std::system_error(internal::last_file_error(), "mapped_file: map");
+            }
+        }
+        file = std::move(handle);
+
+        if (pattern != access_pattern::normal)
+        {
+            advise(pattern);
+        }
+    }
+
+    [[nodiscard]] static usize page_size() noexcept
+    {
+        static const usize size = internal::vm_page_size();
+        return size;
+    }
+
+private:
+    internal::file_handle file;
+    internal::file_mapping mapping;
+    file_access access = file_access::read_only;
+};
+
+/**
+ * 매핑하기에 너무 큰 파일을 고정 크기 청크로 읽는 순차 읽기 도구
+ * 두 개의 정렬된 버퍼를 번갈아 쓰며, 호출자가 한 청크를 처리하는 동안 전용 스레드가 다음 청크를 pread로 미리 읽습니다.
+ * next()가 반환한 span은 다음 next() 호출 전까지 유효합니다.
+ *
+ * @code
+ * sw::chunked_reader reader{ "huge.log" };
+ * u64 hash = 0;
+ * while (auto chunk = reader.next(); !chunk.empty()) { hash = update(hash, chunk); }
+ * @endcode
+ */
+class chunked_reader
+{
+public:
+    static constexpr usize default_chunk_size = 1024 * 1024;
+
+    /** 버퍼 정렬 (O_DIRECT, 페이지 단위 I/O와 호환) */
+    static constexpr usize buffer_alignment = 4096;
+
+    /**
+     * @param chunk_size 청크 크기 (buffer_alignment 배수로 올림)
+     * @throw std::system_error 파일을 열 수 없는 경우
+     */
+    explicit chunked_reader(const std::filesystem::path& path, usize chunk_size = default_chunk_size)
+        : file(internal::open_file_or_throw(path, file_access::read_only, false, "chunked_reader: open"))
+        , chunk_size(aligned_size(std::max<usize>(chunk_size, 1), buffer_alignment))
+    {
+        if (!internal::file_size(file.get(), total_size))
+        {
+            throw std::system_error(internal::last_file_error(), "chunked_reader: size");
+        }
+        internal::file_advise_sequential(file.get());
+
+        for (auto& buffer : buffers)
+        {
+            buffer = static_cast<std::byte*>(::operator new(this->chunk_size, std::align_val_t{ buffer_alignment }));
+        }
+        worker = std::thread([this] { run(); });
+    }
+
+    chunked_reader(const chunked_reader&) = delete;
+    chunked_reader& operator=(const chunked_reader&) = delete;
+
+    ~chunked_reader()
+    {
+        {
+            std::scoped_lock lock{ mutex };
+            stopping = true;
+        }
+        request_ready.notify_one();
+        worker.join();
+
+        for (std::byte* buffer : buffers)
+        {
+            ::operator delete(buffer, chunk_size, std::align_val_t{ buffer_alignment });
+        }
+    }
+
+    /**
+     * 다음 청크를 반환합니다. 파일 끝이면 빈 span을 반환합니다.
+     * @throw std::system_error 읽기에 실패한 경우
+     */
+    [[nodiscard]] std::span<const std::byte> next()
+    {
+        if (!pending && !request(next_offset))
+        {
+            return {};
+        }
+
+        // 미리 읽기 완료 대기
+        isize result;
+        usize index;
+        {
+            std::unique_lock lock{ mutex };
+            read_done.wait(lock, [this] { return job.done; });
+            result = job.result;
+            index = job.buffer;
+            pending = false;
+        }
+        if (result < 0)
+        {
+            throw std::system_error(read_error, "chunked_reader: read");
+        }
+
+        const u64 chunk_offset = next_offset;
+        next_offset += static_cast<u64>(result);
+        current_offset = chunk_offset;
+
+        // 호출자가 이 청크를 처리하는 동안 다른 버퍼로 다음 청크를 읽음
+        if (result > 0)
+        {
+            request(next_offset);
+        }
+        return { buffers[index], static_cast<usize>(result) };
+    }
+
+    /** 다음 next()가 offset부터 읽도록 위치를 옮깁니다. */
+    void seek(u64 offset)
+    {
+        if (pending)
+        {
+            std::unique_lock lock{ mutex };
+            read_done.wait(lock, [this] { return job.done; });
+            pending = false;
+        }
+        next_offset = std::min(offset, total_size);
+    }
+
+    /** 파일 크기 */
+    [[nodiscard]] u64 size() const noexcept { return total_size; }
+
+    /** 마지막으로 반환한 청크의 파일 내 위치 */
+    [[nodiscard]] u64 chunk_offset() const noexcept { return current_offset; }
+
+    /** 다음 청크의 파일 내 위치 */
+    [[nodiscard]] u64 offset() const noexcept { return next_offset; }
+
+    [[nodiscard]] usize chunk_capacity() const noexcept { return chunk_size; }
+
+private:
+    struct read_job
+    {
+        u64 offset = 0;
+        usize buffer = 0;
+        isize result = 0;
+        bool requested = false;
+        bool done = false;
+    };
+
+    /** offset부터 다음 버퍼로 읽기를 요청합니다. 파일 끝이면 false */
+    bool request(u64 offset)
+    {
+        if (offset >= total_size)
+        {
+            return false;
+        }
+
+        {
+            std::scoped_lock lock{ mutex };
+            job.offset = offset;
+            job.buffer = next_buffer;
+            job.requested = true;
+            job.done = false;
+        }
+        next_buffer ^= 1;
+        pending = true;
+        request_ready.notify_one();
+        return true;
+    }
+
+    void run()
+    {
+        std::unique_lock lock{ mutex };
+        while (true)
+        {
+            request_ready.wait(lock, [this] { return stopping || job.requested; });
+            if (stopping)
+            {
+                return;
+            }
+
+            const read_job current = job;
+            job.requested = false;
+            lock.unlock();
+
+            const usize size = static_cast<usize>(std::min<u64>(chunk_size, total_size - current.offset));
+            const isize result = internal::file_read_at(file.get(), buffers[current.buffer], size, current.offset);
+            const std::error_code error = result < 0 ? internal::last_file_error() : std::error_code{};
+
+            lock.lock();
+            job.result = result;
+            job.done = true;
+            read_error = error;
+            read_done.notify_one();
+        }
+    }
+
+private:
+    internal::file_handle file;
+    usize chunk_size;
+    u64 total_size = 0;
+    std::byte* buffers[2] = {};
+
+    // 호출 스레드 전용 상태
+    u64 next_offset = 0;
+    u64 current_offset = 0;
+    usize next_buffer = 0;
+    bool pending = false;
+
+    // 작업 스레드와 공유하는 상태 (mutex로 보호)
+    std::mutex mutex;
+    std::condition_variable request_ready;
+    std::condition_variable read_done;
+    read_job job;
+    std::error_code read_error;
+    bool stopping = false;
+
+    std::thread worker;
+};
+} // namespace sw
@@ -8,6 +8,11 @@
 #include <utility>
 
 #include "sw/types.hpp"
+#include "sw/macros.hpp"
+
+#if SW_ALLOC_TRACKING
+    #include "sw/alloc_tracker.hpp"
+#endif
 
 
 namespace sw
@@ -69,6 +74,19 @@ private:
         {
             return std::construct_at(static_cast<callable_impl*>(dest), std::move(functor));
         }
+
+#if SW_ALLOC_TRACKING
+        // 힙에 저장되는 경우 호출 객체 타입으로 기록
+        static void* operator new(std::size_t size)
+        {
+            return alloc_tracker::allocate<Fn>(size, alignof(callable_impl));
+        }
+
+        static void operator delete(void* ptr, std::size_t size) noexcept
+        {
+            alloc_tracker::deallocate<Fn>(ptr, size, alignof(callable_impl));
+        }
+#endif
     };
 
 public:
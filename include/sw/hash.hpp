@@ -2,6 +2,7 @@
 
 #include <string_view>
 #include <concepts>
+#include <functional>
 
 #include "sw/types.hpp"
 
@@ -48,6 +49,34 @@ constexpr u64 fnv1a(const CharType(&str)[N]) noexcept
     return internal::fnv1a_impl(std::basic_string_view<CharType>{ str, N - 1 });
 }
 
+/** 64비트 해시의 비트를 고르게 섞습니다. (MurmurHash3 fmix64, 정수 항등 해시 등 하위 비트만 다른 값을 퍼뜨릴 때 사용) */
+[[nodiscard]] constexpr u64 hash_mix(u64 hash) noexcept
+{
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/** 키의 64비트 해시 (문자열은 fnv1a, 그 외에는 std::hash) */
+template <typename T>
+struct key_hash
+{
+    [[nodiscard]] u64 operator()(const T& key) const
+    {
+        if constexpr (std::constructible_from<std::string_view, const T&>)
+        {
+            return fnv1a(std::string_view{ key });
+        }
+        else
+        {
+            return static_cast<u64>(std::hash<T>{}(key));
+        }
+    }
+};
+
 namespace literals
 {
 /** 문자열 뒤에 _hash를 붙여 즉시 해시값으로 변환합니다. */
@@ -0,0 +1,1059 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/hash.hpp"
+#include "sw/function.hpp"
+#include "sw/small_vector.hpp"
+#include "sw/spsc_ring.hpp"
+#include "sw/type_signature.hpp"
+
+
+namespace sw
+{
+/** 로그 수준 */
+enum class log_level : u8
+{
+    trace,
+    debug,
+    info,
+    warn,
+    error,
+    fatal,
+};
+
+[[nodiscard]] constexpr std::string_view log_level_name(log_level level) noexcept
+{
+    constexpr std::array<std::string_view, 6> names = { "trace", "debug", "info", "warn", "error", "fatal" };
+    const auto index = static_cast<usize>(level);
+    return index < names.size() ? names[index] : "unknown";
+}
+
+/** 포맷이 끝난 로그 한 줄 (sink와 log_decoder가 전달) */
+struct log_entry
+{
+    log_level level = log_level::info;
+    std::chrono::system_clock::time_point time;
+    std::string_view file;
+    u32 line = 0;
+    std::string_view message;
+};
+
+namespace internal
+{
+/** 인자 종류 (바이너리 파일에도 그대로 기록되므로 값을 바꾸면 안 됨) */
+enum class log_arg_kind : u8
+{
+    signed_integer,
+    unsigned_integer,
+    floating,
+    boolean,
+    character,
+    pointer,
+    string, // u32 길이 + 바이트
+    custom, // 사용자 타입의 원본 바이트 (프로세스 안에서만 formatter로 포맷 가능)
+};
+
+using log_custom_formatter = void (*)(std::string& out, std::string_view spec, const std::byte* data);
+
+/** 인자 하나의 타입 정보 */
+struct log_arg_info
+{
+    log_arg_kind kind;
+    u32 size; // 고정 크기 (string은 0)
+    std::string_view type_name;
+    log_custom_formatter format;
+};
+
+/** 호출 지점 정보 (SW_LOG마다 정적 상수로 하나씩 생성) */
+struct log_location
+{
+    log_level level;
+    std::string_view format;
+    u64 format_id; // 포맷 문자열의 fnv1a 해시 (컴파일 타임 계산)
+    std::string_view file;
+    u32 line;
+};
+
+/** 링 버퍼에 기록되는 레코드 헤더 (뒤에 인자 바이트가 이어짐) */
+struct log_record_header
+{
+    i64 timestamp; // system_clock 기준 나노초
+    const log_location* location;
+    const log_arg_info* args;
+    usize arg_count;
+};
+
+/** 인자 타입을 기록용 타입으로 정규화 (문자 배열 -> const char*) */
+template <typename T>
+using log_stored_t = std::conditional_t<
+    std::is_array_v<std::remove_cvref_t<T>>,
+    const std::remove_extent_t<std::remove_cvref_t<T>>*,
+    std::remove_cvref_t<T>>;
+
+template <typename T>
+constexpr bool is_log_string_v = std::is_same_v<T, std::string_view>
+    || std::is_same_v<T, std::string>
+    || std::is_same_v<T, const char*>
+    || std::is_same_v<T, char*>;
+
+template <typename T>
+consteval log_arg_kind log_kind_of() noexcept
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return log_arg_kind::boolean;
+    }
+    else if constexpr (std::is_same_v<T, char>)
+    {
+        return log_arg_kind::character;
+    }
+    else if constexpr (is_log_string_v<T>)
+    {
+        return log_arg_kind::string;
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        return std::is_signed_v<T> ? log_arg_kind::signed_integer : log_arg_kind::unsigned_integer;
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        return log_arg_kind::floating;
+    }
+    else if constexpr (std::is_pointer_v<T> || std::is_null_pointer_v<T>)
+    {
+        return log_arg_kind::pointer;
+    }
+    else
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+            "sw::log arguments must be arithmetic, pointers, strings or trivially copyable types with a std::formatter");
+        return log_arg_kind::custom;
+    }
+}
+
+/** 원본 바이트에서 T를 복원하여 포맷합니다. (사용자 타입용) */
+template <typename T>
+void format_custom_arg(std::string& out, std::string_view spec, const std::byte* data)
+{
+    std::array<std::byte, sizeof(T)> bytes;
+    std::memcpy(bytes.data(), data, sizeof(T));
+    const T value = std::bit_cast<T>(bytes);
+
+    const std::string pattern = "{:" + std::string(spec) + "}";
+    std::vformat_to(std::back_inserter(out), pattern, std::make_format_args(value));
+}
+
+template <typename T>
+consteval log_arg_info make_log_arg_info() noexcept
+{
+    constexpr log_arg_kind kind = log_kind_of<T>();
+    if constexpr (kind == log_arg_kind::string)
+    {
+        return log_arg_info{ kind, 0, full_type_name<T>(), nullptr };
+    }
+    else if constexpr (kind == log_arg_kind::custom)
+    {
+        return log_arg_info{ kind, static_cast<u32>(sizeof(T)), full_type_name<T>(), &format_custom_arg<T> };
+    }
+    else
+    {
+        return log_arg_info{ kind, static_cast<u32>(sizeof(T)), full_type_name<T>(), nullptr };
+    }
+}
+
+/** 인자 타입 목록의 정보 배열 (인스턴스화된 타입 조합마다 하나) */
+template <typename... Args>
+inline constexpr std::array<log_arg_info, sizeof...(Args)> log_args_of = { make_log_arg_info<Args>()... };
+
+template <typename T>
+[[nodiscard]] std::string_view log_string_of(const T& value) noexcept
+{
+    if constexpr (std::is_pointer_v<T>)
+    {
+        return value ? std::string_view{ value } : std::string_view{};
+    }
+    else
+    {
+        return std::string_view{ value };
+    }
+}
+
+/** 인자 하나를 기록하는 데 필요한 바이트 수 */
+template <typename T>
+[[nodiscard]] usize log_encoded_size(const T& value) noexcept
+{
+    if constexpr (is_log_string_v<T>)
+    {
+        return sizeof(u32) + log_string_of(value).size();
+    }
+    else
+    {
+        return sizeof(T);
+    }
+}
+
+template <typename T>
+std::byte* log_encode(std::byte* out, const T& value) noexcept
+{
+    if constexpr (is_log_string_v<T>)
+    {
+        const std::string_view text = log_string_of(value);
+        const auto length = static_cast<u32>(text.size());
+        std::memcpy(out, &length, sizeof(length));
+        std::memcpy(out + sizeof(length), text.data(), text.size());
+        return out + sizeof(length) + text.size();
+    }
+    else
+    {
+        std::memcpy(out, &value, sizeof(T));
+        return out + sizeof(T);
+    }
+}
+
+template <typename T>
+[[nodiscard]] T log_load(const std::byte* data) noexcept
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+/** 한 인자를 spec에 맞춰 out에 포맷합니다. */
+template <typename T>
+void format_log_value(std::string& out, std::string_view spec, const T& value)
+{
+    if (spec.empty())
+    {
+        std::vformat_to(std::back_inserter(out), "{}", std::make_format_args(value));
+    }
+    else
+    {
+        const std::string pattern = "{:" + std::string(spec) + "}";
+        std::vformat_to(std::back_inserter(out), pattern, std::make_format_args(value));
+    }
+}
+
+/** 디코딩 중인 인자 하나 */
+struct log_arg_view
+{
+    const log_arg_info* info;
+    const std::byte* data;
+    usize size;
+};
+
+inline void format_log_arg(std::string& out, std::string_view spec, const log_arg_view& arg)
+{
+    const auto& info = *arg.info;
+    switch (info.kind)
+    {
+    case log_arg_kind::signed_integer:
+        switch (info.size)
+        {
+        case 1: format_log_value(out, spec, log_load<i8>(arg.data)); return;
+        case 2: format_log_value(out, spec, log_load<i16>(arg.data)); return;
+        case 4: format_log_value(out, spec, log_load<i32>(arg.data)); return;
+        default: format_log_value(out, spec, log_load<i64>(arg.data)); return;
+        }
+    case log_arg_kind::unsigned_integer:
+        switch (info.size)
+        {
+        case 1: format_log_value(out, spec, log_load<u8>(arg.data)); return;
+        case 2: format_log_value(out, spec, log_load<u16>(arg.data)); return;
+        case 4: format_log_value(out, spec, log_load<u32>(arg.data)); return;
+        default: format_log_value(out, spec, log_load<u64>(arg.data)); return;
+        }
+    case log_arg_kind::floating:
+        if (info.size == sizeof(float))
+        {
+            format_log_value(out, spec, log_load<float>(arg.data));
+        }
+        else if (info.size == sizeof(double))
+        {
+            format_log_value(out, spec, log_load<double>(arg.data));
+        }
+        else
+        {
+            format_log_value(out, spec, log_load<long double>(arg.data));
+        }
+        return;
+    case log_arg_kind::boolean:
+        format_log_value(out, spec, log_load<bool>(arg.data));
+        return;
+    case log_arg_kind::character:
+        format_log_value(out, spec, log_load<char>(arg.data));
+        return;
+    case log_arg_kind::pointer:
+        format_log_value(out, spec, reinterpret_cast<const void*>(log_load<usize>(arg.data)));
+        return;
+    case log_arg_kind::string:
+        format_log_value(out, spec, std::string_view{ reinterpret_cast<const char*>(arg.data), arg.size });
+        return;
+    case log_arg_kind::custom:
+        if (info.format)
+        {
+            info.format(out, spec, arg.data);
+        }
+        else
+        {
+            // 오프라인 디코딩: formatter가 없으므로 타입 이름만 표시
+            out += '<';
+            out += info.type_name;
+            out += '>';
+        }
+        return;
+    }
+}
+
+/**
+ * 포맷 문자열과 인자 바이트로 메시지를 만듭니다.
+ * 각 치환 필드({}, {0}, {:x} 등)를 인자 하나씩 std::vformat으로 포맷하므로,
+ * 인자 타입 정보만 있으면 호출 지점의 템플릿 없이도(오프라인 디코더) 포맷할 수 있습니다.
+ * @return 인자 바이트가 잘려 있으면 false
+ */
+inline bool format_log_message(std::string& out, std::string_view format, std::span<const log_arg_info> infos, std::span<const std::byte> payload)
+{
+    // 인자 위치 계산
+    small_vector<log_arg_view, 8> args;
+    usize offset = 0;
+    for (const auto& info : infos)
+    {
+        usize size = info.size;
+        usize skip = 0;
+        if (info.kind == log_arg_kind::string)
+        {
+            if (offset + sizeof(u32) > payload.size())
+            {
+                return false;
+            }
+            size = log_load<u32>(payload.data() + offset);
+            skip = sizeof(u32);
+        }
+        if (offset + skip + size > payload.size())
+        {
+            return false;
+        }
+        args.push_back(log_arg_view{ &info, payload.data() + offset + skip, size });
+        offset += skip + size;
+    }
+
+    usize next_arg = 0;
+    for (usize i = 0; i < format.size(); ++i)
+    {
+        const char c = format[i];
+        if (c == '}')
+        {
+            out += c;
+            i += (i + 1 < format.size() && format[i + 1] == '}') ? 1 : 0;
+            continue;
+        }
+        if (c != '{')
+        {
+            out += c;
+            continue;
+        }
+        if (i + 1 < format.size() && format[i + 1] == '{')
+        {
+            out += '{';
+            ++i;
+            continue;
+        }
+
+        const usize close = format.find('}', i);
+        if (close == std::string_view::npos)
+        {
+            out += format.substr(i);
+            break;
+        }
+
+        // {인덱스:spec}
+        const std::string_view field = format.substr(i + 1, close - i - 1);
+        const usize colon = field.find(':');
+        const std::string_view index_text = field.substr(0, colon);
+        const std::string_view spec = (colon == std::string_view::npos) ? std::string_view{} : field.substr(colon + 1);
+
+        usize index = next_arg++;
+        if (!index_text.empty())
+        {
+            index = 0;
+            for (const char digit : index_text)
+            {
+                index = index * 10 + static_cast<usize>(digit - '0');
+            }
+        }
+
+        if (index < args.size())
+        {
+            try
+            {
+                format_log_arg(out, spec, args[index]);
+            }
+            catch (const std::format_error&)
+            {
+                out += "<format error>";
+            }
+        }
+        else
+        {
+            out += "<missing>";
+        }
+        i = close;
+    }
+    return true;
+}
+
+/** 스레드 하나의 로그 링 버퍼 */
+struct log_thread_ring
+{
+    explicit log_thread_ring(usize capacity)
+        : ring(capacity)
+    {
+    }
+
+    spsc_byte_ring ring;
+    std::atomic<u64> dropped{ 0 };
+};
+
+// -----------------------------------------------------------------------------
+// 바이너리 로그 파일 형식 (같은 엔디안의 머신에서 읽는 것을 가정)
+//   헤더: "SWLOG\0\0\1"
+//   정의: [u8 1][u32 site][u8 level][u32 line][u64 format_id][str file][str format][u32 argc]
+//         argc x [u8 kind][u32 size][str type_name]
+//   기록: [u8 2][u32 site][i64 timestamp][u32 payload_size][payload]
+//   str = [u32 길이][바이트]
+// -----------------------------------------------------------------------------
+constexpr std::array<char, 8> log_file_magic = { 'S', 'W', 'L', 'O', 'G', '\0', '\0', '\1' };
+constexpr u8 log_file_site_entry = 1;
+constexpr u8 log_file_record_entry = 2;
+
+/** 바이너리 로그 파일 작성기 */
+class log_file_writer
+{
+public:
+    bool open(const std::filesystem::path& path)
+    {
+        file.open(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            return false;
+        }
+        file.write(log_file_magic.data(), log_file_magic.size());
+        sites.clear();
+        return static_cast<bool>(file);
+    }
+
+    void close()
+    {
+        file.close();
+        sites.clear();
+    }
+
+    [[nodiscard]] bool is_open() const noexcept { return file.is_open(); }
+
+    void flush() { file.flush(); }
+
+    void write(const log_record_header& header, std::span<const std::byte> payload)
+    {
+        // 처음 보는 (호출 지점, 인자 타입) 조합이면 정의를 먼저 기록
+        const auto [it, inserted] = sites.try_emplace(site_key{ header.location, header.args }, static_cast<u32>(sites.size()));
+        if (inserted)
+        {
+            write_site(it->second, *header.location, std::span{ header.args, header.arg_count });
+        }
+
+        put(log_file_record_entry);
+        put(it->second);
+        put(header.timestamp);
+        put(static_cast<u32>(payload.size()));
+        file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+    }
+
+private:
+    struct site_key
+    {
+        const log_location* location;
+        const log_arg_info* args;
+
+        bool operator==(const site_key&) const = default;
+    };
+
+    struct site_key_hash
+    {
+        usize operator()(const site_key& key) const noexcept
+        {
+            return std::hash<const void*>{}(key.location) ^ (std::hash<const void*>{}(key.args) * 31);
+        }
+    };
+
+    void write_site(u32 site, const log_location& location, std::span<const log_arg_info> args)
+    {
+        put(log_file_site_entry);
+        put(site);
+        put(static_cast<u8>(location.level));
+        put(location.line);
+        put(location.format_id);
+        put_string(location.file);
+        put_string(location.format);
+        put(static_cast<u32>(args.size()));
+        for (const auto& arg : args)
+        {
+            put(static_cast<u8>(arg.kind));
+            put(arg.size);
+            put_string(arg.type_name);
+        }
+    }
+
+    template <typename T>
+    void put(const T& value)
+    {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void put_string(std::string_view text)
+    {
+        put(static_cast<u32>(text.size()));
+        file.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+private:
+    std::ofstream file;
+    std::unordered_map<site_key, u32, site_key_hash> sites;
+};
+} // namespace internal
+
+/**
+ * 비동기 바이너리 로거
+ * 호출 스레드는 포맷하지 않고 (타임스탬프, 호출 지점 포인터, 인자 원본 바이트)만 스레드별 링 버퍼에 기록하며,
+ * 백그라운드 스레드가 레코드를 std::format으로 포맷하여 sink에 전달합니다.
+ * 바이너리 파일을 열면 포맷하지 않은 레코드를 그대로 저장하고, log_decoder로 나중에 읽을 수 있습니다.
+ *
+ * 링 버퍼가 가득 차면 호출 스레드를 막지 않고 레코드를 버립니다. (dropped()로 확인)
+ *
+ * @code
+ * SW_LOG_INFO("connected to {}:{}", host, port);
+ * sw::logger::instance().open_binary_file("app.swlog");
+ * @endcode
+ */
+class logger
+{
+public:
+    using sink_type = function<void(const log_entry&)>;
+
+    // 스레드마다 만드는 링 버퍼의 기본 크기
+    static constexpr usize default_ring_capacity = 1024 * 1024;
+
+public:
+    explicit logger(usize ring_capacity = default_ring_capacity)
+        : id(next_id.fetch_add(1, std::memory_order_relaxed))
+        , ring_capacity(ring_capacity)
+        , worker([this] { run(); })
+    {
+    }
+
+    ~logger()
+    {
+        stop();
+    }
+
+    logger(const logger&) = delete;
+    logger& operator=(const logger&) = delete;
+
+    /** SW_LOG 매크로가 사용하는 전역 로거 */
+    [[nodiscard]] static logger& instance()
+    {
+        static logger global;
+        return global;
+    }
+
+public:
+    void set_level(log_level level) noexcept
+    {
+        min_level.store(level, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] log_level level() const noexcept
+    {
+        return min_level.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool should_log(log_level level) const noexcept
+    {
+        return level >= min_level.load(std::memory_order_relaxed);
+    }
+
+    /** 텍스트 출력 스트림을 설정합니다. (기본: stderr, nullptr이면 끔) */
+    void set_console(std::FILE* stream)
+    {
+        std::scoped_lock lock{ config_mutex };
+        console = stream;
+    }
+
+    /** 포맷된 로그를 받을 sink를 추가합니다. (백그라운드 스레드에서 호출됨) */
+    void add_sink(sink_type sink)
+    {
+        std::scoped_lock lock{ config_mutex };
+        sinks.push_back(std::move(sink));
+    }
+
+    void clear_sinks()
+    {
+        std::scoped_lock lock{ config_mutex };
+        sinks.clear();
+    }
+
+    /** 이후 레코드를 바이너리 파일로 저장합니다. */
+    bool open_binary_file(const std::filesystem::path& path)
+    {
+        flush();
+        std::scoped_lock lock{ config_mutex };
+        return binary_file.open(path);
+    }
+
+    void close_binary_file()
+    {
+        flush();
+        std::scoped_lock lock{ config_mutex };
+        binary_file.close();
+    }
+
+    /** 호출 전에 기록된 모든 레코드가 처리될 때까지 기다립니다. */
+    void flush()
+    {
+        std::unique_lock lock{ state_mutex };
+        if (stopping)
+        {
+            return;
+        }
+        const u64 target = ++flush_requested;
+        wake.notify_one();
+        flushed.wait(lock, [&] { return flush_completed >= target || stopping; });
+    }
+
+    /** 남은 레코드를 처리하고 백그라운드 스레드를 종료합니다. */
+    void stop()
+    {
+        {
+            std::scoped_lock lock{ state_mutex };
+            if (stopping)
+            {
+                return;
+            }
+            stopping = true;
+        }
+        wake.notify_one();
+        flushed.notify_all();
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+
+    /** 링 버퍼가 가득 차 버려진 레코드 수 */
+    [[nodiscard]] u64 dropped() const
+    {
+        std::scoped_lock lock{ rings_mutex };
+        u64 total = retired_dropped;
+        for (const auto& ring : rings)
+        {
+            total += ring->dropped.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /** 레코드 하나를 현재 스레드의 링 버퍼에 기록합니다. */
+    template <typename... Args>
+    void write(const internal::log_location& location, const Args&... args)
+    {
+        const i64 timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+        const auto& infos = internal::log_args_of<Args...>;
+        const internal::log_record_header header{ timestamp, &location, infos.data(), infos.size() };
+        const usize size = sizeof(header) + (usize{ 0 } + ... + internal::log_encoded_size(args));
+
+        auto& ring = local_ring();
+        if (size > ring.ring.max_record_size()) [[unlikely]]
+        {
+            ring.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        const auto dest = ring.ring.reserve(size);
+        if (dest.data() == nullptr) [[unlikely]]
+        {
+            ring.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        std::byte* out = dest.data();
+        std::memcpy(out, &header, sizeof(header));
+        out += sizeof(header);
+        ((out = internal::log_encode(out, args)), ...);
+        ring.ring.commit(size);
+    }
+
+private:
+    internal::log_thread_ring& local_ring()
+    {
+        // 스레드별 링은 (로거, 스레드) 쌍마다 하나
+        // 파괴된 로거와 같은 주소에 새 로거가 생겨도 구분되도록 주소 대신 고유 id로 찾음
+        thread_local std::vector<std::pair<u64, std::shared_ptr<internal::log_thread_ring>>> thread_rings;
+        for (const auto& [owner, ring] : thread_rings)
+        {
+            if (owner == id) [[likely]]
+            {
+                return *ring;
+            }
+        }
+
+        // 로거가 파괴되어 이 스레드만 참조하는 링은 제거
+        std::erase_if(thread_rings, [](const auto& entry) { return entry.second.use_count() == 1; });
+
+        auto ring = std::make_shared<internal::log_thread_ring>(ring_capacity);
+        {
+            std::scoped_lock lock{ rings_mutex };
+            rings.push_back(ring);
+        }
+        thread_rings.emplace_back(id, ring);
+        return *ring;
+    }
+
+    void run()
+    {
+        std::vector<std::shared_ptr<internal::log_thread_ring>> snapshot;
+        std::string message;
+        while (true)
+        {
+            u64 target;
+            bool exiting;
+            {
+                std::unique_lock lock{ state_mutex };
+                wake.wait_for(lock, idle_interval, [&] { return stopping || flush_requested > flush_completed; });
+                target = flush_requested;
+                exiting = stopping;
+            }
+
+            {
+                std::scoped_lock lock{ rings_mutex };
+                snapshot = rings;
+            }
+            drain(snapshot, message);
+            retire_finished_rings();
+
+            {
+                std::scoped_lock lock{ state_mutex };
+                flush_completed = target;
+            }
+            flushed.notify_all();
+
+            if (exiting)
+            {
+                break;
+            }
+        }
+    }
+
+    void drain(const std::vector<std::shared_ptr<internal::log_thread_ring>>& targets, std::string& message)
+    {
+        std::scoped_lock lock{ config_mutex };
+        for (const auto& target : targets)
+        {
+            auto& ring = target->ring;
+            for (auto record = ring.peek(); record.data() != nullptr; record = ring.peek())
+            {
+                internal::log_record_header header;
+                std::memcpy(&header, record.data(), sizeof(header));
+                const auto payload = record.subspan(sizeof(header));
+
+                if (binary_file.is_open())
+                {
+                    binary_file.write(header, payload);
+                }
+                if (console || !sinks.empty())
+                {
+                    message.clear();
+                    internal::format_log_message(message, header.location->format, std::span{ header.args, header.arg_count }, payload);
+                    dispatch(log_entry{
+                        header.location->level,
+                        std::chrono::system_clock::time_point{ std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds{ header.timestamp }) },
+                        header.location->file,
+                        header.location->line,
+                        message
+                    });
+                }
+                ring.release();
+            }
+        }
+        if (console)
+        {
+            std::fflush(console);
+        }
+        if (binary_file.is_open())
+        {
+            binary_file.flush();
+        }
+    }
+
+    void dispatch(const log_entry& entry)
+    {
+        if (console)
+        {
+            const auto time = std::chrono::floor<std::chrono::microseconds>(entry.time);
+            const std::string line = std::format("[{:%F %T}] [{}] {}\n", time, log_level_name(entry.level), entry.message);
+            std::fwrite(line.data(), 1, line.size(), console);
+        }
+        for (auto& sink : sinks)
+        {
+            sink(entry);
+        }
+    }
+
+    /** 종료된 스레드의 링 중 비어 있는 것을 정리합니다. */
+    void retire_finished_rings()
+    {
+        std::scoped_lock lock{ rings_mutex };
+        std::erase_if(rings, [&](const std::shared_ptr<internal::log_thread_ring>& ring)
+        {
+            // 스레드 로컬 참조가 사라졌고 남은 레코드가 없으면 제거
+            if (ring.use_count() == 1 && ring->ring.empty())
+            {
+                retired_dropped += ring->dropped.load(std::memory_order_relaxed);
+                return true;
+            }
+            return false;
+        });
+    }
+
+private:
+    static constexpr std::chrono::milliseconds idle_interval{ 2 };
+
+    // 로거마다 발급하는 고유 id (스레드 로컬 링 목록의 키)
+    static inline std::atomic<u64> next_id{ 0 };
+
+    const u64 id;
+    const usize ring_capacity;
+    std::atomic<log_level> min_level{ log_level::info };
+
+    // 스레드별 링
+    mutable std::mutex rings_mutex;
+    std::vector<std::shared_ptr<internal::log_thread_ring>> rings;
+    u64 retired_dropped = 0;
+
+    // 출력 설정 (백그라운드 스레드가 처리하는 동안 잠금)
+    std::mutex config_mutex;
+    std::FILE* console = stderr;
+    std::vector<sink_type> sinks;
+    internal::log_file_writer binary_file;
+
+    // 백그라운드 스레드 제어
+    std::mutex state_mutex;
+    std::condition_variable wake;
+    std::condition_variable flushed;
+    u64 flush_requested = 0;
+    u64 flush_completed = 0;
+    bool stopping = false;
+
+    std::thread worker;
+};
+
+/** location 호출 지점의 레코드를 전역 로거에 기록합니다. (SW_LOG 매크로에서 사용) */
+template <typename... Args>
+void log(const internal::log_location& location, std::format_string<const Args&...> /*format*/, const Args&... args)
+{
+    logger::instance().write<internal::log_stored_t<Args>...>(location, args...);
+}
+
+/**
+ * 바이너리 로그 파일 디코더
+ * logger::open_binary_file로 저장한 파일을 읽어 한 줄씩 포맷합니다.
+ * 사용자 타입 인자는 formatter가 없으므로 "<타입 이름>"으로 표시됩니다.
+ *
+ * @code
+ * sw::log_decoder decoder{ "app.swlog" };
+ * while (auto entry = decoder.next()) { std::println("{}", entry->message); }
+ * @endcode
+ */
+class log_decoder
+{
+public:
+    explicit log_decoder(const std::filesystem::path& path)
+        : file(path, std::ios::binary)
+    {
+        std::array<char, internal::log_file_magic.size()> magic{};
+        file.read(magic.data(), magic.size());
+        valid = file && magic == internal::log_file_magic;
+    }
+
+    /** 파일이 열렸고 형식이 올바른지 확인합니다. */
+    [[nodiscard]] bool is_valid() const noexcept { return valid; }
+
+    /**
+     * 다음 레코드를 포맷하여 반환합니다.
+     * @return 파일 끝이거나 손상된 경우 nullptr (반환된 항목은 다음 호출 전까지 유효)
+     */
+    [[nodiscard]] const log_entry* next()
+    {
+        while (valid)
+        {
+            u8 kind;
+            if (!get(kind))
+            {
+                return nullptr;
+            }
+
+            if (kind == internal::log_file_site_entry)
+            {
+                if (!read_site())
+                {
+                    valid = false;
+                }
+                continue;
+            }
+            if (kind != internal::log_file_record_entry)
+            {
+                valid = false;
+                return nullptr;
+            }
+
+            u32 site_index;
+            i64 timestamp;
+            u32 payload_size;
+            if (!get(site_index) || !get(timestamp) || !get(payload_size) || site_index >= sites.size())
+            {
+                valid = false;
+                return nullptr;
+            }
+            payload.resize(payload_size);
+            if (!file.read(reinterpret_cast<char*>(payload.data()), payload_size))
+            {
+                valid = false;
+                return nullptr;
+            }
+
+            const site& s = *sites[site_index];
+            message.clear();
+            internal::format_log_message(message, s.format, s.args, payload);
+
+            entry = log_entry{
+                s.level,
+                std::chrono::system_clock::time_point{ std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds{ timestamp }) },
+                s.file,
+                s.line,
+                message
+            };
+            return &entry;
+        }
+        return nullptr;
+    }
+
+private:
+    /** 파일에 정의된 호출 지점 (문자열은 여기서 소유) */
+    struct site
+    {
+        log_level level;
+        u32 line;
+        u64 format_id;
+        std::string file;
+        std::string format;
+        std::vector<std::string> type_names;
+        std::vector<internal::log_arg_info> args;
+    };
+
+    bool read_site()
+    {
+        u32 index;
+        u8 level;
+        auto s = std::make_unique<site>();
+        u32 argc;
+        if (!get(index) || !get(level) || !get(s->line) || !get(s->format_id)
+            || !get_string(s->file) || !get_string(s->format) || !get(argc) || index != sites.size())
+        {
+            return false;
+        }
+
+        s->level = static_cast<log_level>(level);
+        s->type_names.resize(argc);
+        s->args.resize(argc);
+        for (u32 i = 0; i < argc; ++i)
+        {
+            u8 arg_kind;
+            if (!get(arg_kind) || !get(s->args[i].size) || !get_string(s->type_names[i]))
+            {
+                return false;
+            }
+            s->args[i].kind = static_cast<internal::log_arg_kind>(arg_kind);
+            s->args[i].type_name = s->type_names[i];
+            s->args[i].format = nullptr;
+        }
+        sites.push_back(std::move(s));
+        return true;
+    }
+
+    template <typename T>
+    bool get(T& value)
+    {
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    bool get_string(std::string& text)
+    {
+        u32 length;
+        if (!get(length))
+        {
+            return false;
+        }
+        text.resize(length);
+        return static_cast<bool>(file.read(text.data(), length));
+    }
+
+private:
+    std::ifstream file;
+    bool valid = false;
+    std::vector<std::unique_ptr<site>> sites;
+    std::vector<std::byte> payload;
+    std::string message;
+    log_entry entry;
+};
+} // namespace sw
+
+// name(문자열 리터럴) 포맷으로 전역 로거에 기록 (인자는 수준 검사를 통과한 경우에만 평가)
+#define SW_LOG(level, fmt, ...) \
+    do \
+    { \
+        if (::sw::logger::instance().should_log(level)) \
+        { \
+            static constexpr ::sw::internal::log_location sw_log_location{ level, fmt, ::sw::fnv1a(fmt), __FILE__, __LINE__ }; \
+            ::sw::log(sw_log_location, fmt __VA_OPT__(,) __VA_ARGS__); \
+        } \
+    } \
+    while (false)
+
+#define SW_LOG_TRACE(fmt, ...) SW_LOG(::sw::log_level::trace, fmt __VA_OPT__(,) __VA_ARGS__)
+#define SW_LOG_DEBUG(fmt, ...) SW_LOG(::sw::log_level::debug, fmt __VA_OPT__(,) __VA_ARGS__)
+#define SW_LOG_INFO(fmt, ...) SW_LOG(::sw::log_level::info, fmt __VA_OPT__(,) __VA_ARGS__)
+#define SW_LOG_WARN(fmt, ...) SW_LOG(::sw::log_level::warn, fmt __VA_OPT__(,) __VA_ARGS__)
+#define SW_LOG_ERROR(fmt, ...) SW_LOG(::sw::log_level::error, fmt __VA_OPT__(,) __VA_ARGS__)
+#define SW_LOG_FATAL(fmt, ...) SW_LOG(::sw::log_level::fatal, fmt __VA_OPT__(,) __VA_ARGS__)
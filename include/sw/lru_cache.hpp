@@ -0,0 +1,517 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/hash.hpp"
+#include "sw/memory.hpp"
+
+
+namespace sw
+{
+/** 캐시가 가득 찼을 때 내보낼 항목을 고르는 방식 */
+enum class eviction_policy : u8
+{
+    lru,   // 정확한 LRU: 조회할 때마다 목록 맨 앞으로 옮기므로 조회도 샤드의 쓰기 잠금을 잡음
+    clock, // CLOCK 근사: 조회는 참조 비트만 세우고 읽기 잠금만 잡음, 내보낼 때 참조된 항목에 한 번 더 기회를 줌
+};
+
+/** 캐시 통계 (모든 샤드 합계) */
+struct cache_stats
+{
+    u64 hits = 0;
+    u64 misses = 0;
+    u64 evictions = 0;
+
+    [[nodiscard]] double hit_ratio() const noexcept
+    {
+        const u64 lookups = hits + misses;
+        return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+    }
+};
+
+namespace internal
+{
+/** 항목마다 비용 1 (capacity = 최대 항목 수) */
+struct unit_cost
+{
+    template <typename K, typename V>
+    [[nodiscard]] constexpr usize operator()(const K&, const V&) const noexcept
+    {
+        return 1;
+    }
+};
+} // namespace internal
+
+/**
+ * 해시로 나눈 샤드마다 잠금을 따로 두는 스레드 안전 LRU 캐시
+ * 샤드는 침습형 이중 연결 리스트(최근 사용 순서)와 노드 인덱스를 담는 선형 탐사 해시 테이블로 이루어지며, 노드는 고정 크기
+ * 페이지에 할당되어 재해시해도 옮겨지지 않습니다. 서로 다른 샤드의 키는 잠금 경쟁 없이 동시에 접근됩니다.
+ * 내보내기는 샤드 단위로 일어나므로 캐시 전체로는 근사 LRU입니다.
+ *
+ * @tparam K 키 타입
+ * @tparam V 값 타입 (조회 시 복사해서 반환하므로, 큰 값은 std::shared_ptr<const T> 등으로 저장)
+ * @tparam Cost (const K&, const V&) -> usize, 항목 비용 (기본: 1, capacity가 항목 수 제한이 됨. 바이트 수를 반환하면 용량 제한)
+ * @tparam Hash K -> 정수 해시 (기본: sw::key_hash, 결과는 hash_mix로 섞어 사용)
+ *
+ * @code
+ * sw::lru_cache<std::string, image> images{ 1024 };
+ * images.put("logo", load("logo.png"));
+ * if (auto cached = images.get("logo")) { draw(*cached); }
+ *
+ * // 바이트 수 제한 + 읽기 위주 부하용 CLOCK
+ * auto bytes = [](const std::string& key, const std::string& value) { return key.size() + value.size(); };
+ * sw::lru_cache<std::string, std::string, decltype(bytes)> pages{ 64 << 20, sw::eviction_policy::clock, 0, bytes };
+ * @endcode
+ */
+template <typename K, typename V, typename Cost = internal::unit_cost, typename Hash = key_hash<K>, typename KeyEqual = std::equal_to<K>>
+class lru_cache
+{
+    static_assert(std::is_invocable_r_v<usize, const Cost&, const K&, const V&>, "Cost must be callable as usize(const K&, const V&)");
+
+    static constexpr u32 npos = std::numeric_limits<u32>::max();
+    static constexpr u32 page_size = 1024;
+
+    struct node
+    {
+        std::optional<std::pair<K, V>> item;
+        usize cost = 0;
+        u32 hash = 0;
+        u32 prev = npos;
+        u32 next = npos;
+        std::atomic<bool> referenced = false; // CLOCK 참조 비트 (읽기 잠금 아래에서 씀)
+    };
+
+    /** 인덱스 테이블 칸 (hash는 32비트로 줄인 해시: 노드를 읽지 않고 비교와 원래 위치 계산에 사용) */
+    struct index_slot
+    {
+        u32 node = npos;
+        u32 hash = 0;
+    };
+
+    struct alignas(cache_line_size) shard
+    {
+        mutable std::shared_mutex mutex;
+
+        std::vector<std::unique_ptr<node[]>> pages;
+        u32 allocated = 0;
+        u32 free_head = npos;
+
+        std::vector<index_slot> index;
+        u32 head = npos; // 가장 최근
+        u32 tail = npos; // 다음 내보낼 후보
+
+        usize count = 0;
+        usize cost = 0;
+
+        // 읽기 잠금 아래에서도 갱신하므로 원자적 카운터
+        std::atomic<u64> hits = 0;
+        std::atomic<u64> misses = 0;
+        u64 evictions = 0;
+
+        [[nodiscard]] node& at(u32 i) noexcept { return pages[i / page_size][i % page_size]; }
+        [[nodiscard]] const node& at(u32 i) const noexcept { return pages[i / page_size][i % page_size]; }
+    };
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+
+    /**
+     * @param capacity 최대 비용 합계 (기본 Cost에서는 최대 항목 수), 샤드마다 capacity / shard_count씩 나눔
+     * @param policy 내보내기 방식
+     * @param shard_count 샤드 수 (2의 거듭제곱으로 올림, 0이면 하드웨어 스레드 수의 4배, 샤드당 용량이 1 이상이 되도록 줄임)
+     */
+    explicit lru_cache(usize capacity, eviction_policy policy = eviction_policy::lru, usize shard_count = 0, Cost cost = {}, Hash hash = {}, KeyEqual equal = {})
+        : cost_of(std::move(cost))
+        , hasher(std::move(hash))
+        , equal(std::move(equal))
+        , policy(policy)
+    {
+        if (shard_count == 0)
+        {
+            shard_count = std::max<usize>(std::thread::hardware_concurrency(), 1) * 4;
+        }
+        shard_count = std::min(std::bit_ceil(shard_count), std::bit_floor(std::max<usize>(capacity, 1)));
+
+        shard_bits = static_cast<u32>(std::countr_zero(shard_count));
+        shard_capacity = std::max<usize>(capacity / shard_count, 1);
+        shards = std::make_unique<shard[]>(shard_count);
+    }
+
+    lru_cache(const lru_cache&) = delete;
+    lru_cache& operator=(const lru_cache&) = delete;
+
+public:
+    /** key의 값을 복사해 반환합니다. (LRU: 가장 최근으로 옮김, CLOCK: 참조 비트만 세움) */
+    [[nodiscard]] std::optional<V> get(const K& key)
+    {
+        const u64 hash = hash_of(key);
+        shard& s = shard_of(hash);
+
+        if (policy == eviction_policy::clock)
+        {
+            std::shared_lock lock{ s.mutex };
+            const u32 found = find(s, key, static_cast<u32>(hash));
+            if (found == npos)
+            {
+                s.misses.fetch_add(1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            node& n = s.at(found);
+            if (!n.referenced.load(std::memory_order_relaxed))
+            {
+                n.referenced.store(true, std::memory_order_relaxed);
+            }
+            s.hits.fetch_add(1, std::memory_order_relaxed);
+            return n.item->second;
+        }
+
+        std::unique_lock lock{ s.mutex };
+        const u32 found = find(s, key, static_cast<u32>(hash));
+        if (found == npos)
+        {
+            s.misses.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        unlink(s, found);
+        push_front(s, found);
+        s.hits.fetch_add(1, std::memory_order_relaxed);
+        return s.at(found).item->second;
+    }
+
+    /** 최근 사용 순서나 통계를 바꾸지 않고 key가 있는지 확인합니다. */
+    [[nodiscard]] bool contains(const K& key) const
+    {
+        const u64 hash = hash_of(key);
+        const shard& s = shard_of(hash);
+        std::shared_lock lock{ s.mutex };
+        return find(s, key, static_cast<u32>(hash)) != npos;
+    }
+
+    /**
+     * key에 value를 저장합니다. (이미 있으면 교체) 비용 합계가 샤드 용량을 넘으면 내보낼 항목부터 제거합니다.
+     * @return 저장했으면 true, 항목 하나의 비용이 샤드 용량보다 커서 저장하지 않았으면 false (기존 값도 제거됨)
+     */
+    bool put(K key, V value)
+    {
+        const u64 hash = hash_of(key);
+        const usize item_cost = std::invoke(cost_of, std::as_const(key), std::as_const(value));
+        shard& s = shard_of(hash);
+
+        std::unique_lock lock{ s.mutex };
+        if (const u32 found = find(s, key, static_cast<u32>(hash)); found != npos)
+        {
+            remove(s, found);
+        }
+        if (item_cost > shard_capacity)
+        {
+            return false;
+        }
+
+        while (s.count > 0 && s.cost + item_cost > shard_capacity)
+        {
+            evict_one(s);
+        }
+
+        const u32 index = allocate_node(s);
+        node& n = s.at(index);
+        try
+        {
+            n.item.emplace(std::move(key), std::move(value));
+            insert_index(s, index, static_cast<u32>(hash));
+        }
+        catch (...)
+        {
+            n.item.reset();
+            free_node(s, index);
+            throw;
+        }
+
+        n.cost = item_cost;
+        n.hash = static_cast<u32>(hash);
+        n.referenced.store(false, std::memory_order_relaxed);
+        push_front(s, index);
+        ++s.count;
+        s.cost += item_cost;
+        return true;
+    }
+
+    /** key를 제거합니다. @return 제거했으면 true */
+    bool erase(const K& key)
+    {
+        const u64 hash = hash_of(key);
+        shard& s = shard_of(hash);
+
+        std::unique_lock lock{ s.mutex };
+        const u32 found = find(s, key, static_cast<u32>(hash));
+        if (found == npos)
+        {
+            return false;
+        }
+        remove(s, found);
+        return true;
+    }
+
+    /** 모든 항목을 제거합니다. (통계는 유지) */
+    void clear()
+    {
+        for_each_shard([this](shard& s)
+        {
+            std::unique_lock lock{ s.mutex };
+            while (s.head != npos)
+            {
+                remove(s, s.head);
+            }
+        });
+    }
+
+public:
+    /** 저장된 항목 수 (모든 샤드 합계, 다른 스레드가 수정 중이면 근사값) */
+    [[nodiscard]] usize size() const
+    {
+        usize total = 0;
+        for_each_shard([&](const shard& s)
+        {
+            std::shared_lock lock{ s.mutex };
+            total += s.count;
+        });
+        return total;
+    }
+
+    [[nodiscard]] bool empty() const { return size() == 0; }
+
+    /** 저장된 항목의 비용 합계 */
+    [[nodiscard]] usize total_cost() const
+    {
+        usize total = 0;
+        for_each_shard([&](const shard& s)
+        {
+            std::shared_lock lock{ s.mutex };
+            total += s.cost;
+        });
+        return total;
+    }
+
+    /** 비용 합계의 상한 (샤드 용량 x 샤드 수) */
+    [[nodiscard]] usize capacity() const noexcept { return shard_capacity << shard_bits; }
+    [[nodiscard]] usize shard_count() const noexcept { return usize{ 1 } << shard_bits; }
+    [[nodiscard]] eviction_policy eviction() const noexcept { return policy; }
+
+    [[nodiscard]] cache_stats stats() const
+    {
+        cache_stats result;
+        for_each_shard([&](const shard& s)
+        {
+            std::shared_lock lock{ s.mutex };
+            result.hits += s.hits.load(std::memory_order_relaxed);
+            result.misses += s.misses.load(std::memory_order_relaxed);
+            result.evictions += s.evictions;
+        });
+        return result;
+    }
+
+private:
+    [[nodiscard]] u64 hash_of(const K& key) const
+    {
+        return hash_mix(static_cast<u64>(std::invoke(hasher, key)));
+    }
+
+    /** 샤드는 상위 비트, 인덱스 테이블 위치는 하위 비트로 골라 서로 겹치지 않게 함 */
+    [[nodiscard]] shard& shard_of(u64 hash) const noexcept
+    {
+        return shards[shard_bits == 0 ? 0 : hash >> (64 - shard_bits)];
+    }
+
+    template <typename Fn>
+    void for_each_shard(Fn&& fn) const
+    {
+        for (usize i = 0; i < shard_count(); ++i)
+        {
+            fn(shards[i]);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // 인덱스 테이블 (선형 탐사, 부하율 1/2 이하, 삭제는 뒤쪽 항목을 당겨 묘비 없이 처리)
+    // -------------------------------------------------------------------------
+    [[nodiscard]] u32 find(const shard& s, const K& key, u32 hash) const
+    {
+        if (s.index.empty())
+        {
+            return npos;
+        }
+
+        const usize mask = s.index.size() - 1;
+        for (usize slot = hash & mask;; slot = (slot + 1) & mask)
+        {
+            const index_slot& entry = s.index[slot];
+            if (entry.node == npos)
+            {
+                return npos;
+            }
+            if (entry.hash == hash && std::invoke(equal, s.at(entry.node).item->first, key))
+            {
+                return entry.node;
+            }
+        }
+    }
+
+    void insert_index(shard& s, u32 node_index, u32 hash)
+    {
+        if ((s.count + 1) * 2 > s.index.size())
+        {
+            rehash(s, std::max<usize>(s.index.size() * 2, 16));
+        }
+
+        const usize mask = s.index.size() - 1;
+        usize slot = hash & mask;
+        while (s.index[slot].node != npos)
+        {
+            slot = (slot + 1) & mask;
+        }
+        s.index[slot] = index_slot{ node_index, hash };
+    }
+
+    void rehash(shard& s, usize new_size)
+    {
+        std::vector<index_slot> table(new_size);
+        const usize mask = new_size - 1;
+        for (const index_slot& entry : s.index)
+        {
+            if (entry.node == npos)
+            {
+                continue;
+            }
+            usize slot = entry.hash & mask;
+            while (table[slot].node != npos)
+            {
+                slot = (slot + 1) & mask;
+            }
+            table[slot] = entry;
+        }
+        s.index = std::move(table);
+    }
+
+    void erase_index(shard& s, u32 node_index, u32 hash) noexcept
+    {
+        const usize mask = s.index.size() - 1;
+        usize hole = hash & mask;
+        while (s.index[hole].node != node_index)
+        {
+            hole = (hole + 1) & mask;
+        }
+
+        // 빈칸 뒤의 항목 중 원래 위치가 빈칸 이전(순환 기준)인 항목을 당겨 탐사 사슬을 유지
+        for (usize slot = (hole + 1) & mask; s.index[slot].node != npos; slot = (slot + 1) & mask)
+        {
+            const usize home = s.index[slot].hash & mask;
+            if (((slot - home) & mask) >= ((slot - hole) & mask))
+            {
+                s.index[hole] = s.index[slot];
+                hole = slot;
+            }
+        }
+        s.index[hole] = index_slot{};
+    }
+
+    // -------------------------------------------------------------------------
+    // 노드 풀과 최근 사용 목록
+    // -------------------------------------------------------------------------
+    [[nodiscard]] u32 allocate_node(shard& s)
+    {
+        if (s.free_head != npos)
+        {
+            const u32 index = s.free_head;
+            s.free_head = s.at(index).next;
+            return index;
+        }
+
+        if (s.allocated == s.pages.size() * page_size)
+        {
+            s.pages.push_back(std::make_unique<node[]>(page_size));
+        }
+        return s.allocated++;
+    }
+
+    void free_node(shard& s, u32 index) noexcept
+    {
+        node& n = s.at(index);
+        n.prev = npos;
+        n.next = s.free_head;
+        s.free_head = index;
+    }
+
+    void push_front(shard& s, u32 index) noexcept
+    {
+        node& n = s.at(index);
+        n.prev = npos;
+        n.next = s.head;
+        (s.head != npos ? s.at(s.head).prev : s.tail) = index;
+        s.head = index;
+    }
+
+    void unlink(shard& s, u32 index) noexcept
+    {
+        node& n = s.at(index);
+        (n.prev != npos ? s.at(n.prev).next : s.head) = n.next;
+        (n.next != npos ? s.at(n.next).prev : s.tail) = n.prev;
+    }
+
+    void remove(shard& s, u32 index) noexcept
+    {
+        node& n = s.at(index);
+        erase_index(s, index, n.hash);
+        unlink(s, index);
+        --s.count;
+        s.cost -= n.cost;
+        n.item.reset();
+        free_node(s, index);
+    }
+
+    /** 목록 끝에서 한 항목을 내보냅니다. (CLOCK: 참조 비트가 선 항목은 비트를 지우고 맨 앞으로 보내 한 번 더 기회를 줌) */
+    void evict_one(shard& s) noexcept
+    {
+        u32 victim = s.tail;
+        if (policy == eviction_policy::clock)
+        {
+            // 모든 항목이 참조되었어도 한 바퀴 돌면 비트가 지워지므로 종료됨
+            while (s.at(victim).referenced.load(std::memory_order_relaxed))
+            {
+                s.at(victim).referenced.store(false, std::memory_order_relaxed);
+                unlink(s, victim);
+                push_front(s, victim);
+                victim = s.tail;
+            }
+        }
+        remove(s, victim);
+        ++s.evictions;
+    }
+
+private:
+    SW_NO_UNIQUE_ADDRESS Cost cost_of;
+    SW_NO_UNIQUE_ADDRESS Hash hasher;
+    SW_NO_UNIQUE_ADDRESS KeyEqual equal;
+
+    eviction_policy policy;
+    u32 shard_bits = 0;
+    usize shard_capacity = 0;
+    std::unique_ptr<shard[]> shards;
+};
+} // namespace sw
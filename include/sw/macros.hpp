@@ -42,6 +42,16 @@
     #define SW_ARCH_ARM64 false
 #endif
 
+// -----------------------------------------------------------------------------
+// Cache Line Size
+// -----------------------------------------------------------------------------
+// Apple Silicon은 128바이트 캐시 라인을 사용하며, 그 외 x86/x64/ARM64는 64바이트
+#if SW_ARCH_ARM64 && SW_PLATFORM_MACOS
+    #define SW_CACHE_LINE_SIZE 128
+#else
+    #define SW_CACHE_LINE_SIZE 64
+#endif
+
 // -----------------------------------------------------------------------------
 // Compiler Detection
 // -----------------------------------------------------------------------------
@@ -74,6 +84,19 @@
     #define SW_BUILD_RELEASE true
 #endif
 
+// -----------------------------------------------------------------------------
+// Allocation Tracking
+// -----------------------------------------------------------------------------
+// swlib 내부 할당 지점을 sw::alloc_tracker에 기록 (모든 번역 단위에서 같은 값이어야 함)
+#ifndef SW_ALLOC_TRACKING
+    #define SW_ALLOC_TRACKING false
+#endif
+
+// 전역 operator new/delete를 교체하여 기록 (src/alloc_tracker.cpp, SW_ALLOC_TRACKING 필요)
+#ifndef SW_ALLOC_TRACKING_GLOBAL_NEW
+    #define SW_ALLOC_TRACKING_GLOBAL_NEW false
+#endif
+
 // -----------------------------------------------------------------------------
 // Utility Macros (Inlining, DebugBreak, etc.)
 // -----------------------------------------------------------------------------
@@ -90,6 +113,28 @@
     #define SW_NO_INLINE
 #endif
 
+// No Unique Address (빈 멤버가 공간을 차지하지 않도록)
+#if SW_COMPILER_MSVC
+    #define SW_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+    #define SW_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+// Target (함수 하나만 특정 명령어 집합으로 컴파일, 예: SW_TARGET("avx2,bmi2"))
+// MSVC는 대상 지정 없이 모든 intrinsic을 허용하므로 비워 둠
+#if SW_COMPILER_CLANG || SW_COMPILER_GCC
+    #define SW_TARGET(features) __attribute__((target(features)))
+#else
+    #define SW_TARGET(features)
+#endif
+
+// Prefetch (곧 읽을 주소를 미리 캐시로 가져오도록 힌트)
+#if SW_COMPILER_CLANG || SW_COMPILER_GCC
+    #define SW_PREFETCH(address) __builtin_prefetch(address)
+#else
+    #define SW_PREFETCH(address) ((void)(address))
+#endif
+
 // Debug Break
 #if SW_COMPILER_MSVC
     #define SW_DEBUGBREAK() __debugbreak()
@@ -1,10 +1,24 @@
 #pragma once
 
+#include <algorithm>
 #include <bit>
 #include <concepts>
 #include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 #include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/type_traits.hpp"
+
+#if SW_ALLOC_TRACKING
+    #include "sw/alloc_tracker.hpp"
+#endif
 
 
 namespace sw
@@ -44,4 +58,400 @@ constexpr usize aligned_size()
 {
     return aligned_size<Alignment>(sizeof(T));
 }
+
+/**
+ * src의 객체를 dst로 재배치(relocate)합니다. dst에 이동 생성한 뒤 src를 파괴합니다.
+ * trivially relocatable 타입은 memcpy 한 번으로 처리합니다.
+ * @param src 살아 있는 객체
+ * @param dst 초기화되지 않은 메모리
+ * @return dst
+ */
+template <typename T>
+T* relocate_at(T* src, T* dst) noexcept(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>)
+{
+    if constexpr (is_trivially_relocatable_v<T>)
+    {
+        std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), sizeof(T));
+        return std::launder(dst);
+    }
+    else
+    {
+        T* result = std::construct_at(dst, std::move(*src));
+        std::destroy_at(src);
+        return result;
+    }
+}
+
+/** src의 객체를 값으로 꺼내고 src를 파괴합니다. */
+template <typename T>
+    requires std::move_constructible<T>
+[[nodiscard]] T relocate(T* src) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    T result(std::move(*src));
+    std::destroy_at(src);
+    return result;
+}
+
+/**
+ * [first, first + count) 범위의 객체를 초기화되지 않은 메모리 dst로 재배치합니다.
+ * trivially relocatable 타입은 memmove 한 번으로 처리하므로 범위가 겹쳐도 되며,
+ * 그 외 타입은 앞에서부터 옮기므로 dst가 first보다 뒤에서 겹치면 안 됩니다.
+ * @return 재배치된 마지막 원소 다음 위치
+ */
+template <typename T>
+T* uninitialized_relocate_n(T* first, usize count, T* dst) noexcept(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>)
+{
+    if constexpr (is_trivially_relocatable_v<T>)
+    {
+        if (count > 0)
+        {
+            std::memmove(static_cast<void*>(dst), static_cast<const void*>(first), count * sizeof(T));
+        }
+        return dst + count;
+    }
+    else if constexpr (std::is_nothrow_move_constructible_v<T>)
+    {
+        for (usize i = 0; i < count; ++i)
+        {
+            std::construct_at(dst + i, std::move(first[i]));
+            std::destroy_at(first + i);
+        }
+        return dst + count;
+    }
+    else
+    {
+        // 이동 중 예외가 나면 원본은 그대로 남도록 모두 옮긴 뒤에 파괴
+        T* result = std::uninitialized_move_n(first, count, dst).second;
+        std::destroy_n(first, count);
+        return result;
+    }
+}
+
+/** [first, last) 범위의 객체를 초기화되지 않은 메모리 dst로 재배치합니다. */
+template <typename T>
+T* uninitialized_relocate(T* first, T* last, T* dst) noexcept(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>)
+{
+    return uninitialized_relocate_n(first, static_cast<usize>(last - first), dst);
+}
+
+/** 대상 아키텍처의 캐시 라인 크기 (SW_CACHE_LINE_SIZE) */
+inline constexpr usize cache_line_size = SW_CACHE_LINE_SIZE;
+
+/**
+ * 값을 캐시 라인 단위로 정렬/패딩하여 다른 데이터와 같은 캐시 라인을 공유하지 않도록 합니다. (False Sharing 방지)
+ * @code
+ * struct queue_state
+ * {
+ *     sw::cache_padded<std::atomic<u64>> head; // 생산자만 씀
+ *     sw::cache_padded<std::atomic<u64>> tail; // 소비자만 씀
+ * };
+ * @endcode
+ */
+template <typename T>
+struct alignas(cache_line_size) cache_padded
+{
+    T value{};
+
+    constexpr cache_padded() = default;
+
+    template <typename... Args>
+        requires std::constructible_from<T, Args...>
+    constexpr explicit cache_padded(std::in_place_t, Args&&... args)
+        : value(std::forward<Args>(args)...)
+    {
+    }
+
+    template <typename U>
+        requires (std::constructible_from<T, U> && !std::same_as<std::remove_cvref_t<U>, cache_padded>)
+    constexpr cache_padded(U&& init)
+        : value(std::forward<U>(init))
+    {
+    }
+
+    [[nodiscard]] constexpr T& get() noexcept { return value; }
+    [[nodiscard]] constexpr const T& get() const noexcept { return value; }
+
+    [[nodiscard]] constexpr T* operator->() noexcept { return &value; }
+    [[nodiscard]] constexpr const T* operator->() const noexcept { return &value; }
+
+    [[nodiscard]] constexpr T& operator*() noexcept { return value; }
+    [[nodiscard]] constexpr const T& operator*() const noexcept { return value; }
+};
+
+/**
+ * 블록 체인 기반 범프(bump/linear) 할당자
+ * 할당은 현재 블록의 커서를 정렬 후 밀어내기만 하므로 O(1)이며, 개별 해제 없이 reset()/rewind()로 한 번에 되돌립니다.
+ * 블록은 reset() 후에도 유지되어 다음 프레임/요청에서 재사용됩니다.
+ * @note arena에 생성한 객체의 소멸자는 호출되지 않습니다. (trivially destructible 타입에 적합)
+ *
+ * @code
+ * sw::arena frame_arena;
+ * while (running)
+ * {
+ *     auto* items = frame_arena.allocate_array<Item>(count);
+ *     auto* node = frame_arena.create<Node>(1, 2);
+ *     ...
+ *     frame_arena.reset(); // 이번 프레임의 모든 할당을 한 번에 해제
+ * }
+ * @endcode
+ */
+class arena
+{
+private:
+    /** 블록 헤더 (블록 메모리 앞부분에 위치) */
+    struct block_header
+    {
+        block_header* next;
+        usize capacity; // 헤더를 제외한 사용 가능 크기
+    };
+
+    static constexpr usize header_size = aligned_size<block_header, alignof(std::max_align_t)>();
+
+public:
+    /** rewind()로 되돌아갈 위치 */
+    struct marker
+    {
+        block_header* block = nullptr;
+        u8* cursor = nullptr;
+    };
+
+    static constexpr usize default_block_size = 64 * 1024;
+
+public:
+    explicit arena(usize block_size = default_block_size) noexcept
+        : block_size(block_size)
+    {
+    }
+
+    ~arena()
+    {
+        release();
+    }
+
+    arena(const arena&) = delete;
+    arena& operator=(const arena&) = delete;
+
+    arena(arena&& other) noexcept
+        : first(std::exchange(other.first, nullptr))
+        , current(std::exchange(other.current, nullptr))
+        , cursor(std::exchange(other.cursor, nullptr))
+        , limit(std::exchange(other.limit, nullptr))
+        , block_size(other.block_size)
+    {
+    }
+
+    arena& operator=(arena&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            first = std::exchange(other.first, nullptr);
+            current = std::exchange(other.current, nullptr);
+            cursor = std::exchange(other.cursor, nullptr);
+            limit = std::exchange(other.limit, nullptr);
+            block_size = other.block_size;
+        }
+        return *this;
+    }
+
+public:
+    /**
+     * size 바이트를 alignment에 맞춰 할당합니다.
+     * @param size 할당할 크기
+     * @param alignment 정렬 단위 (반드시 2의 거듭제곱이어야 함)
+     */
+    [[nodiscard]] void* allocate(usize size, usize alignment = alignof(std::max_align_t))
+    {
+        assert(std::has_single_bit(alignment) && "Alignment must be power of 2");
+
+        if (current)
+        {
+            u8* aligned = align_cursor(cursor, alignment);
+            if (aligned + size <= limit)
+            {
+                cursor = aligned + size;
+                return aligned;
+            }
+        }
+        return allocate_slow(size, alignment);
+    }
+
+    /** T 타입 count개를 저장할 수 있는 초기화되지 않은 메모리를 할당합니다. */
+    template <typename T>
+    [[nodiscard]] T* allocate_array(usize count)
+    {
+        return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    /** T 객체를 arena에 생성합니다. 소멸자는 호출되지 않습니다. */
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+        return std::construct_at(allocate_array<T>(1), std::forward<Args>(args)...);
+    }
+
+    /** 현재 할당 위치를 반환합니다. */
+    [[nodiscard]] marker get_marker() const noexcept
+    {
+        return marker{ current, cursor };
+    }
+
+    /** marker 이후의 모든 할당을 되돌립니다. 블록은 해제하지 않고 재사용합니다. */
+    void rewind(const marker& m) noexcept
+    {
+        if (!m.block)
+        {
+            reset();
+            return;
+        }
+        current = m.block;
+        cursor = m.cursor;
+        limit = block_begin(current) + current->capacity;
+    }
+
+    /** 모든 할당을 되돌립니다. 블록은 해제하지 않고 재사용합니다. */
+    void reset() noexcept
+    {
+        current = first;
+        if (current)
+        {
+            cursor = block_begin(current);
+            limit = cursor + current->capacity;
+        }
+    }
+
+    /** 모든 블록을 해제합니다. */
+    void release() noexcept
+    {
+        block_header* block = first;
+        while (block)
+        {
+            block_header* next = block->next;
+#if SW_ALLOC_TRACKING
+            alloc_tracker::deallocate<arena>(block, header_size + block->capacity, alignof(std::max_align_t));
+#else
+            ::operator delete(block, header_size + block->capacity, std::align_val_t{ alignof(std::max_align_t) });
+#endif
+            block = next;
+        }
+        first = current = nullptr;
+        cursor = limit = nullptr;
+    }
+
+    /** 블록들이 확보한 전체 메모리 크기를 반환합니다. (헤더 제외) */
+    [[nodiscard]] usize reserved_bytes() const noexcept
+    {
+        usize total = 0;
+        for (const block_header* block = first; block; block = block->next)
+        {
+            total += block->capacity;
+        }
+        return total;
+    }
+
+private:
+    [[nodiscard]] static u8* block_begin(block_header* block) noexcept
+    {
+        return reinterpret_cast<u8*>(block) + header_size;
+    }
+
+    [[nodiscard]] static u8* align_cursor(u8* ptr, usize alignment) noexcept
+    {
+        const usize address = reinterpret_cast<usize>(ptr);
+        return ptr + (aligned_size(address, alignment) - address);
+    }
+
+    SW_NO_INLINE void* allocate_slow(usize size, usize alignment)
+    {
+        // 이전에 확보해 둔 다음 블록들 중 들어갈 수 있는 블록이 있으면 재사용
+        block_header* prev = current;
+        block_header* candidate = current ? current->next : first;
+        while (candidate)
+        {
+            u8* begin = block_begin(candidate);
+            u8* aligned = align_cursor(begin, alignment);
+            if (aligned + size <= begin + candidate->capacity)
+            {
+                return bump_into(candidate, aligned, size);
+            }
+            prev = candidate;
+            candidate = candidate->next;
+        }
+
+        // 큰 할당은 전용 크기의 블록을 만듦
+        const usize capacity = std::max(block_size, aligned_size(size + alignment, alignof(std::max_align_t)));
+#if SW_ALLOC_TRACKING
+        void* memory = alloc_tracker::allocate<arena>(header_size + capacity, alignof(std::max_align_t));
+#else
+        void* memory = ::operator new(header_size + capacity, std::align_val_t{ alignof(std::max_align_t) });
+#endif
+        auto* block = static_cast<block_header*>(memory);
+        block->next = nullptr;
+        block->capacity = capacity;
+
+        if (prev)
+        {
+            prev->next = block;
+        }
+        else
+        {
+            first = block;
+        }
+        return bump_into(block, align_cursor(block_begin(block), alignment), size);
+    }
+
+    void* bump_into(block_header* block, u8* aligned, usize size) noexcept
+    {
+        current = block;
+        cursor = aligned + size;
+        limit = block_begin(block) + block->capacity;
+        return aligned;
+    }
+
+private:
+    block_header* first = nullptr;
+    block_header* current = nullptr;
+    u8* cursor = nullptr;
+    u8* limit = nullptr;
+    usize block_size;
+};
+
+/**
+ * arena를 std::pmr::memory_resource로 사용하기 위한 어댑터
+ * deallocate는 아무 일도 하지 않으며, 메모리는 arena의 reset()/release()로 회수됩니다.
+ *
+ * @code
+ * sw::arena a;
+ * sw::arena_resource resource{ a };
+ * std::pmr::vector<int> values{ &resource };
+ * @endcode
+ */
+class arena_resource final : public std::pmr::memory_resource
+{
+public:
+    explicit arena_resource(arena& target) noexcept
+        : target(&target)
+    {
+    }
+
+    [[nodiscard]] arena& get_arena() const noexcept { return *target; }
+
+protected:
+    virtual void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        return target->allocate(bytes, alignment);
+    }
+
+    virtual void do_deallocate(void*, std::size_t, std::size_t) override
+    {
+    }
+
+    [[nodiscard]] virtual bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+private:
+    arena* target;
+};
 } // namespace sw
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/type_list.hpp"
+
+
+namespace sw
+{
+namespace internal
+{
+/**
+ * 정렬이 큰 타입부터 배치하는 저장 순서 (같은 정렬끼리는 선언 순서 유지)
+ * sizeof는 항상 alignof의 배수이므로, 이 순서로 놓으면 필드 사이 패딩이 없고 끝의 패딩만 남습니다.
+ */
+template <typename... Ts>
+consteval std::array<usize, sizeof...(Ts)> packed_storage_order() noexcept
+{
+    constexpr std::array<usize, sizeof...(Ts)> alignments{ alignof(Ts)... };
+    std::array<usize, sizeof...(Ts)> order{};
+
+    // 안정 삽입 정렬 (std::stable_sort는 constexpr가 아님)
+    for (usize i = 0; i < order.size(); ++i)
+    {
+        usize j = i;
+        while (j > 0 && alignments[order[j - 1]] < alignments[i])
+        {
+            order[j] = order[j - 1];
+            --j;
+        }
+        order[j] = i;
+    }
+    return order;
+}
+
+template <typename... Ts, usize... J>
+auto packed_storage_sequence(std::index_sequence<J...>) -> std::index_sequence<packed_storage_order<Ts...>()[J]...>;
+
+/** 선언 순서 인덱스 I를 꼬리표로 갖는 필드 하나 */
+template <usize I, typename T>
+struct packed_leaf
+{
+    constexpr packed_leaf() = default;
+
+    template <typename U>
+    constexpr packed_leaf(std::in_place_t, U&& init)
+        : value(std::forward<U>(init))
+    {
+    }
+
+    SW_NO_UNIQUE_ADDRESS T value{};
+};
+
+template <typename Order, typename... Ts>
+struct packed_storage;
+
+/**
+ * 기반 클래스는 선언한 순서대로 배치되므로, 저장 순서(Order)로 packed_leaf를 상속해 필드 순서를 바꿉니다.
+ * 각 leaf는 선언 순서 인덱스로 구분되어 get<I>가 원래 순서를 유지합니다.
+ */
+template <usize... Order, typename... Ts>
+struct packed_storage<std::index_sequence<Order...>, Ts...>
+    : packed_leaf<Order, type_at_t<type_list<Ts...>, Order>>...
+{
+    constexpr packed_storage() = default;
+
+    template <typename Args>
+    constexpr packed_storage(std::in_place_t, Args&& args)
+        : packed_leaf<Order, type_at_t<type_list<Ts...>, Order>>(std::in_place, std::get<Order>(std::forward<Args>(args)))...
+    {
+    }
+};
+} // namespace internal
+
+/**
+ * 패딩이 최소가 되도록 필드를 정렬 순으로 재배치해 저장하는 튜플
+ * get<I>와 구조적 바인딩은 선언 순서를 그대로 따르므로, 읽기 쉬운 순서로 필드를 선언해도 크기가 늘지 않습니다.
+ * 모든 필드가 trivially copyable이면 packed_tuple도 trivially copyable입니다.
+ *
+ * @code
+ * sizeof(std::tuple<u8, u64, u8, u32>);        // 24
+ * sizeof(sw::packed_tuple<u8, u64, u8, u32>);  // 16 (u64, u32, u8, u8 순으로 저장)
+ * auto [flag, id, kind, count] = record;       // 선언 순서
+ * @endcode
+ */
+template <typename... Ts>
+class packed_tuple
+{
+    static_assert((std::is_object_v<Ts> && ...), "packed_tuple fields must be object types");
+
+    using storage_type = internal::packed_storage<
+        decltype(internal::packed_storage_sequence<Ts...>(std::index_sequence_for<Ts...>{})), Ts...>;
+
+    template <usize I>
+    using field_type = type_at_t<type_list<Ts...>, I>;
+
+    template <usize I>
+    using leaf_type = internal::packed_leaf<I, field_type<I>>;
+
+public:
+    /** 저장 순서 (저장 위치 k에 놓인 필드의 선언 순서 인덱스) */
+    static constexpr std::array<usize, sizeof...(Ts)> storage_order = internal::packed_storage_order<Ts...>();
+
+    constexpr packed_tuple() = default;
+
+    /** 선언 순서대로 필드 값을 받습니다. */
+    template <typename... Args>
+        requires (sizeof...(Args) == sizeof...(Ts) && sizeof...(Ts) > 0 && (std::constructible_from<Ts, Args&&> && ...))
+    constexpr explicit(!(std::convertible_to<Args&&, Ts> && ...)) packed_tuple(Args&&... args)
+        : storage(std::in_place, std::forward_as_tuple(std::forward<Args>(args)...))
+    {
+    }
+
+    constexpr explicit packed_tuple(const std::tuple<Ts...>& values)
+        : storage(std::in_place, values)
+    {
+    }
+
+    constexpr explicit packed_tuple(std::tuple<Ts...>&& values)
+        : storage(std::in_place, std::move(values))
+    {
+    }
+
+    /** 선언 순서의 std::tuple로 변환합니다. */
+    [[nodiscard]] constexpr std::tuple<Ts...> to_tuple() const
+    {
+        return [this]<usize... I>(std::index_sequence<I...>)
+        {
+            return std::tuple<Ts...>{ get<I>()... };
+        }(std::index_sequence_for<Ts...>{});
+    }
+
+    /** 선언 순서 I번째 필드 */
+    template <usize I>
+    [[nodiscard]] constexpr field_type<I>& get() & noexcept
+    {
+        return static_cast<leaf_type<I>&>(storage).value;
+    }
+
+    template <usize I>
+    [[nodiscard]] constexpr const field_type<I>& get() const& noexcept
+    {
+        return static_cast<const leaf_type<I>&>(storage).value;
+    }
+
+    template <usize I>
+    [[nodiscard]] constexpr field_type<I>&& get() && noexcept
+    {
+        return std::move(static_cast<leaf_type<I>&>(storage).value);
+    }
+
+    template <usize I>
+    [[nodiscard]] constexpr const field_type<I>&& get() const&& noexcept
+    {
+        return std::move(static_cast<const leaf_type<I>&>(storage).value);
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const packed_tuple& lhs, const packed_tuple& rhs)
+        requires (std::equality_comparable<Ts> && ...)
+    {
+        return [&]<usize... I>(std::index_sequence<I...>)
+        {
+            return ((lhs.get<I>() == rhs.get<I>()) && ...);
+        }(std::index_sequence_for<Ts...>{});
+    }
+
+private:
+    storage_type storage;
+};
+
+template <typename... Ts>
+packed_tuple(Ts...) -> packed_tuple<Ts...>;
+
+/** 선언 순서 I번째 필드 (std::get과 같은 형태) */
+template <usize I, typename... Ts>
+[[nodiscard]] constexpr decltype(auto) get(packed_tuple<Ts...>& tuple) noexcept
+{
+    return tuple.template get<I>();
+}
+
+template <usize I, typename... Ts>
+[[nodiscard]] constexpr decltype(auto) get(const packed_tuple<Ts...>& tuple) noexcept
+{
+    return tuple.template get<I>();
+}
+
+template <usize I, typename... Ts>
+[[nodiscard]] constexpr decltype(auto) get(packed_tuple<Ts...>&& tuple) noexcept
+{
+    return std::move(tuple).template get<I>();
+}
+} // namespace sw
+
+template <typename... Ts>
+struct std::tuple_size<sw::packed_tuple<Ts...>> : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template <std::size_t I, typename... Ts>
+struct std::tuple_element<I, sw::packed_tuple<Ts...>>
+{
+    using type = sw::type_at_t<sw::type_list<Ts...>, I>;
+};
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "sw/types.hpp"
+#include "sw/memory.hpp"
+
+
+namespace sw
+{
+namespace internal
+{
+/**
+ * 스레드 순번 발급기
+ * 종료한 스레드의 순번을 가장 작은 것부터 재사용하므로, 동시에 살아 있는 스레드들은 항상 서로 다르고 작은 순번을 가집니다.
+ */
+class thread_slot_registry
+{
+public:
+    u32 acquire()
+    {
+        std::scoped_lock lock{ mutex };
+        if (free_slots.empty())
+        {
+            // release에서 할당이 일어나지 않도록 발급한 순번 수만큼 미리 확보
+            free_slots.reserve(static_cast<usize>(next) + 1);
+            return next++;
+        }
+
+        std::ranges::pop_heap(free_slots, std::greater{});
+        const u32 slot = free_slots.back();
+        free_slots.pop_back();
+        return slot;
+    }
+
+    void release(u32 slot) noexcept
+    {
+        std::scoped_lock lock{ mutex };
+        free_slots.push_back(slot);
+        std::ranges::push_heap(free_slots, std::greater{});
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<u32> free_slots; // 최소 힙
+    u32 next = 0;
+};
+
+/** 정적 객체 파괴 이후에 종료하는 스레드도 순번을 반납할 수 있도록 파괴하지 않음 */
+inline thread_slot_registry& slot_registry()
+{
+    static thread_slot_registry* registry = new thread_slot_registry;
+    return *registry;
+}
+
+/** 스레드가 살아 있는 동안 순번 하나를 점유합니다. */
+struct thread_slot
+{
+    const u32 value = slot_registry().acquire();
+
+    ~thread_slot()
+    {
+        slot_registry().release(value);
+    }
+};
+
+/** 현재 스레드의 순번 (샤드 선택에 사용, 스레드가 종료되면 반납되어 재사용됨) */
+inline u32 current_thread_slot() noexcept
+{
+    thread_local const thread_slot slot;
+    return slot.value;
+}
+
+/** 기본 샤드 수: 하드웨어 스레드 수를 2의 거듭제곱으로 올림 */
+inline usize default_shard_count() noexcept
+{
+    const usize hw = std::max(std::thread::hardware_concurrency(), 1u);
+    return std::bit_ceil(hw);
+}
+} // namespace internal
+
+/**
+ * 스레드별로 샤딩된 값 컨테이너
+ * 살아 있는 스레드마다 서로 다른 샤드를 가지며, 각 샤드는 cache_padded로 분리되어 캐시 라인을 공유하지 않습니다.
+ * 동시에 살아 있는 스레드 수가 샤드 수를 넘으면 샤드 묶음(segment)을 두 배씩 추가하고, 기존 샤드는 옮기지 않습니다.
+ * 종료한 스레드의 샤드는 이후 생성되는 스레드가 값을 그대로 이어받습니다.
+ * @note local()은 자기 스레드만 쓰므로 T가 스레드 안전할 필요는 없지만,
+ *       다른 스레드가 쓰는 중에 for_each/combine으로 읽으려면 T가 그에 안전해야 합니다. (예: std::atomic)
+ *
+ * @code
+ * sw::per_thread<std::atomic<u64>> hits;
+ * hits.local().fetch_add(1, std::memory_order_relaxed);           // 각 스레드에서
+ * u64 total = hits.combine(u64{ 0 }, [](u64 acc, const auto& v) { return acc + v.load(); });
+ * @endcode
+ */
+template <typename T>
+class per_thread
+{
+public:
+    explicit per_thread(usize shard_count = internal::default_shard_count())
+        : base_bits(static_cast<u32>(std::countr_zero(std::bit_ceil(std::max<usize>(shard_count, 1)))))
+    {
+        segments[0].store(new cache_padded<T>[segment_size(0)], std::memory_order_relaxed);
+    }
+
+    ~per_thread()
+    {
+        for (auto& segment : segments)
+        {
+            delete[] segment.load(std::memory_order_relaxed);
+        }
+    }
+
+    per_thread(const per_thread&) = delete;
+    per_thread& operator=(const per_thread&) = delete;
+
+public:
+    /** 현재 스레드의 샤드를 반환합니다. */
+    [[nodiscard]] T& local() noexcept
+    {
+        const u32 slot = internal::current_thread_slot();
+        const usize index = segment_of(slot);
+        cache_padded<T>* segment = segments[index].load(std::memory_order_acquire);
+        if (!segment) [[unlikely]]
+        {
+            segment = grow(index);
+        }
+        return segment[slot - segment_begin(index)].value;
+    }
+
+    /** 모든 샤드에 대해 fn(T&)를 호출합니다. */
+    template <typename Fn>
+    void for_each(Fn&& fn)
+    {
+        for (usize index = 0; index < max_segments; ++index)
+        {
+            if (cache_padded<T>* segment = segments[index].load(std::memory_order_acquire))
+            {
+                for (usize i = 0; i < segment_size(index); ++i)
+                {
+                    fn(segment[i].value);
+                }
+            }
+        }
+    }
+
+    template <typename Fn>
+    void for_each(Fn&& fn) const
+    {
+        for (usize index = 0; index < max_segments; ++index)
+        {
+            if (const cache_padded<T>* segment = segments[index].load(std::memory_order_acquire))
+            {
+                for (usize i = 0; i < segment_size(index); ++i)
+                {
+                    fn(segment[i].value);
+                }
+            }
+        }
+    }
+
+    /** 모든 샤드를 op(acc, shard)로 합칩니다. */
+    template <typename Acc, typename Op>
+    [[nodiscard]] Acc combine(Acc init, Op&& op) const
+    {
+        for_each([&](const T& shard) { init = op(std::move(init), shard); });
+        return init;
+    }
+
+    /** 현재 할당된 샤드 수를 반환합니다. */
+    [[nodiscard]] usize size() const noexcept
+    {
+        usize total = 0;
+        for (usize index = 0; index < max_segments; ++index)
+        {
+            if (segments[index].load(std::memory_order_acquire))
+            {
+                total += segment_size(index);
+            }
+        }
+        return total;
+    }
+
+private:
+    // 묶음 0은 [0, base), 묶음 k는 [base << (k - 1), base << k) 순번을 담음 (u32 순번 전체를 덮음)
+    static constexpr usize max_segments = 33;
+
+    [[nodiscard]] usize segment_of(u32 slot) const noexcept
+    {
+        return static_cast<usize>(std::bit_width(static_cast<usize>(slot) >> base_bits));
+    }
+
+    [[nodiscard]] usize segment_begin(usize index) const noexcept
+    {
+        return index == 0 ? 0 : usize{ 1 } << (base_bits + index - 1);
+    }
+
+    [[nodiscard]] usize segment_size(usize index) const noexcept
+    {
+        return usize{ 1 } << (base_bits + (index == 0 ? 0 : index - 1));
+    }
+
+    /** 비어 있는 묶음을 할당합니다. 다른 스레드가 먼저 설치했으면 그것을 사용합니다. */
+    cache_padded<T>* grow(usize index) noexcept
+    {
+        auto* fresh = new cache_padded<T>[segment_size(index)];
+        cache_padded<T>* expected = nullptr;
+        if (segments[index].compare_exchange_strong(expected, fresh, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return fresh;
+        }
+        delete[] fresh;
+        return expected;
+    }
+
+private:
+    u32 base_bits;
+    std::atomic<cache_padded<T>*> segments[max_segments]{};
+};
+
+/**
+ * 스레드별로 샤딩된 카운터
+ * 증가는 자기 샤드에만 relaxed로 쓰므로 경합이 없고, value()는 모든 샤드를 합산합니다.
+ */
+template <typename Integer = i64>
+    requires std::is_integral_v<Integer>
+class sharded_counter
+{
+public:
+    explicit sharded_counter(usize shard_count = internal::default_shard_count())
+        : shards(shard_count)
+    {
+    }
+
+    void add(Integer delta) noexcept
+    {
+        shards.local().fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    void increment() noexcept { add(1); }
+    void decrement() noexcept { add(-1); }
+
+    /** 모든 샤드의 합을 반환합니다. (동시에 증가 중이면 근사값) */
+    [[nodiscard]] Integer value() const noexcept
+    {
+        return shards.combine(Integer{ 0 }, [](Integer acc, const std::atomic<Integer>& shard)
+        {
+            return acc + shard.load(std::memory_order_relaxed);
+        });
+    }
+
+    void reset() noexcept
+    {
+        shards.for_each([](std::atomic<Integer>& shard) { shard.store(0, std::memory_order_relaxed); });
+    }
+
+private:
+    per_thread<std::atomic<Integer>> shards;
+};
+} // namespace sw
@@ -0,0 +1,367 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/type_id.hpp"
+
+#if SW_ALLOC_TRACKING
+    #include "sw/alloc_tracker.hpp"
+#endif
+
+
+namespace sw
+{
+namespace internal
+{
+// poly 기본 인라인 버퍼 크기
+constexpr usize poly_default_capacity = sizeof(void*) * 6;
+using poly_align = std::max_align_t;
+}
+
+/**
+ * 인터페이스(Interface)를 구현한 파생 객체를 값(value)으로 보관하는 다형성 홀더
+ * 파생 객체가 인라인 버퍼(Capacity)에 들어가면 버퍼에, 그렇지 않으면 힙에 저장합니다.
+ * @tparam Interface 다형성 기반 클래스 (가상 소멸자 필요)
+ * @tparam Capacity 인라인 버퍼 크기 (바이트)
+ *
+ * @code
+ * std::vector<sw::poly<Shape>> shapes;
+ * shapes.emplace_back(Circle{ 1.0f });   // 힙 할당 없이 vector 내부에 저장
+ * shapes.push_back(sw::poly<Shape>::make<Rect>(2.0f, 3.0f));
+ * for (auto& s : shapes) { s->area(); }
+ * @endcode
+ */
+template <typename Interface, usize Capacity = internal::poly_default_capacity>
+    requires (std::has_virtual_destructor_v<Interface> && Capacity >= sizeof(void*))
+class poly
+{
+private:
+    /** Type Erasure Interface */
+    struct holder_base
+    {
+        virtual ~holder_base() = default;
+        virtual Interface* get() noexcept = 0;
+        virtual type_id type() const noexcept = 0;
+
+        virtual holder_base* clone_to_heap() const = 0;
+        virtual holder_base* clone_to_buffer(void* dest) const = 0;
+        virtual holder_base* move_to_buffer(void* dest) noexcept = 0;
+    };
+
+    /** Concrete Implementation */
+    template <typename Derived>
+    struct holder_impl final : holder_base
+    {
+        Derived object;
+
+        template <typename... Args>
+        explicit holder_impl(std::in_place_t, Args&&... args)
+            : object(std::forward<Args>(args)...)
+        {
+        }
+
+        virtual Interface* get() noexcept override
+        {
+            return std::addressof(object);
+        }
+
+        virtual type_id type() const noexcept override
+        {
+            return type_id::get<Derived>();
+        }
+
+        virtual holder_base* clone_to_heap() const override
+        {
+            if constexpr (std::is_copy_constructible_v<Derived>)
+            {
+                return new holder_impl(std::in_place, object);
+            }
+            else
+            {
+                throw_not_copyable();
+            }
+        }
+
+        virtual holder_base* clone_to_buffer(void* dest) const override
+        {
+            if constexpr (std::is_copy_constructible_v<Derived>)
+            {
+                return std::construct_at(static_cast<holder_impl*>(dest), std::in_place, object);
+            }
+            else
+            {
+                throw_not_copyable();
+            }
+        }
+
+        virtual holder_base* move_to_buffer(void* dest) noexcept override
+        {
+            return std::construct_at(static_cast<holder_impl*>(dest), std::in_place, std::move(object));
+        }
+
+        [[noreturn]] static void throw_not_copyable()
+        {
+            throw std::logic_error("sw::poly: stored type is not copy constructible");
+        }
+
+#if SW_ALLOC_TRACKING
+        // 힙에 저장되는 경우 파생 타입으로 기록
+        static void* operator new(std::size_t size)
+        {
+            return alloc_tracker::allocate<Derived>(size, alignof(holder_impl));
+        }
+
+        static void operator delete(void* ptr, std::size_t size) noexcept
+        {
+            alloc_tracker::deallocate<Derived>(ptr, size, alignof(holder_impl));
+        }
+#endif
+    };
+
+    /** Derived를 인라인 버퍼에 저장할 수 있는지 여부 */
+    template <typename Derived>
+    static constexpr bool fits_inline = (sizeof(holder_impl<Derived>) <= Capacity)
+        && (alignof(holder_impl<Derived>) <= alignof(internal::poly_align))
+        && std::is_nothrow_move_constructible_v<Derived>;
+
+public:
+    poly() noexcept = default;
+
+    poly(std::nullptr_t) noexcept
+    {
+    }
+
+    ~poly()
+    {
+        destroy();
+    }
+
+    /** Derived 객체를 복사/이동하여 보관합니다. */
+    template <typename Derived>
+        requires (
+            !std::same_as<std::remove_cvref_t<Derived>, poly>                 // 자기 자신은 제외
+            && !std::same_as<std::remove_cvref_t<Derived>, std::nullptr_t>    // nullptr_t는 별도 생성자에서 처리
+            && std::derived_from<std::remove_cvref_t<Derived>, Interface>
+        )
+    poly(Derived&& object)
+    {
+        emplace_impl<std::remove_cvref_t<Derived>>(std::forward<Derived>(object));
+    }
+
+    /** Derived 객체를 제자리에서(in-place) 생성합니다. */
+    template <typename Derived, typename... Args>
+        requires std::derived_from<Derived, Interface>
+    explicit poly(std::in_place_type_t<Derived>, Args&&... args)
+    {
+        emplace_impl<Derived>(std::forward<Args>(args)...);
+    }
+
+    poly(const poly& other)
+    {
+        if (other.holder)
+        {
+            if (other.is_on_heap())
+            {
+                holder = other.holder->clone_to_heap();
+                storage.heap_storage = holder;
+            }
+            else
+            {
+                holder = other.holder->clone_to_buffer(storage.sbo_storage);
+            }
+            object = holder->get();
+        }
+    }
+
+    poly(poly&& other) noexcept
+    {
+        take(std::move(other));
+    }
+
+    poly& operator=(const poly& other)
+    {
+        if (this != &other)
+        {
+            poly temp(other);
+            destroy();
+            take(std::move(temp));
+        }
+        return *this;
+    }
+
+    poly& operator=(poly&& other) noexcept
+    {
+        if (this != &other)
+        {
+            destroy();
+            take(std::move(other));
+        }
+        return *this;
+    }
+
+    poly& operator=(std::nullptr_t) noexcept
+    {
+        destroy();
+        return *this;
+    }
+
+    /** Derived 타입의 poly를 생성합니다. */
+    template <typename Derived, typename... Args>
+        requires std::derived_from<Derived, Interface>
+    [[nodiscard]] static poly make(Args&&... args)
+    {
+        return poly(std::in_place_type<Derived>, std::forward<Args>(args)...);
+    }
+
+public:
+    /** 기존 객체를 파괴하고 Derived 객체를 새로 생성합니다. */
+    template <typename Derived, typename... Args>
+        requires std::derived_from<Derived, Interface>
+    Derived& emplace(Args&&... args)
+    {
+        destroy();
+        emplace_impl<Derived>(std::forward<Args>(args)...);
+        return static_cast<Derived&>(*object);
+    }
+
+    void reset() noexcept
+    {
+        destroy();
+    }
+
+    void swap(poly& other) noexcept
+    {
+        poly temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    [[nodiscard]] bool is_valid() const noexcept
+    {
+        return holder != nullptr;
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept
+    {
+        return is_valid();
+    }
+
+    /** 보관 중인 객체가 인라인 버퍼에 저장되어 있는지 확인합니다. */
+    [[nodiscard]] bool is_inline() const noexcept
+    {
+        return holder != nullptr && !is_on_heap();
+    }
+
+    /** 보관 중인 파생 객체의 type_id를 반환합니다. (비어 있으면 유효하지 않은 type_id) */
+    [[nodiscard]] type_id type() const noexcept
+    {
+        return holder ? holder->type() : type_id{};
+    }
+
+    /** 보관 중인 객체가 정확히 Derived 타입인지 확인합니다. */
+    template <typename Derived>
+    [[nodiscard]] bool holds() const noexcept
+    {
+        return type() == type_id::get<Derived>();
+    }
+
+    [[nodiscard]] Interface* get() noexcept { return object; }
+    [[nodiscard]] const Interface* get() const noexcept { return object; }
+
+    [[nodiscard]] Interface* operator->() noexcept { return object; }
+    [[nodiscard]] const Interface* operator->() const noexcept { return object; }
+
+    [[nodiscard]] Interface& operator*() noexcept { return *object; }
+    [[nodiscard]] const Interface& operator*() const noexcept { return *object; }
+
+    [[nodiscard]] bool operator==(std::nullptr_t) const noexcept
+    {
+        return !is_valid();
+    }
+
+private:
+    template <typename Derived, typename... Args>
+    void emplace_impl(Args&&... args)
+    {
+        using impl_type = holder_impl<Derived>;
+
+        if constexpr (fits_inline<Derived>)
+        {
+            holder = std::construct_at(reinterpret_cast<impl_type*>(storage.sbo_storage), std::in_place, std::forward<Args>(args)...);
+        }
+        else
+        {
+            holder = new impl_type(std::in_place, std::forward<Args>(args)...);
+            storage.heap_storage = holder;
+        }
+        object = holder->get();
+    }
+
+    /** other의 객체를 가져옵니다. (this는 비어 있어야 함) */
+    void take(poly&& other) noexcept
+    {
+        if (other.holder)
+        {
+            if (other.is_on_heap())
+            {
+                // 힙 포인터만 이동
+                storage.heap_storage = other.storage.heap_storage;
+                holder = other.holder;
+                object = other.object;
+            }
+            else
+            {
+                // 인라인 데이터 이동 후 원본 파괴
+                holder = other.holder->move_to_buffer(storage.sbo_storage);
+                object = holder->get();
+                std::destroy_at(other.holder);
+            }
+
+            // 원본 초기화 (소멸자에서 해제 안되도록)
+            other.storage.heap_storage = nullptr;
+            other.holder = nullptr;
+            other.object = nullptr;
+        }
+    }
+
+    [[nodiscard]] bool is_on_heap() const noexcept
+    {
+        // holder가 sbo_storage의 주소와 다르면 힙에 있는 것임
+        return holder != reinterpret_cast<const holder_base*>(storage.sbo_storage);
+    }
+
+    void destroy() noexcept
+    {
+        if (holder)
+        {
+            if (is_on_heap())
+            {
+                delete holder;
+            }
+            else
+            {
+                std::destroy_at(holder);
+            }
+            holder = nullptr;
+            object = nullptr;
+        }
+    }
+
+private:
+    union poly_storage_t
+    {
+        holder_base* heap_storage;
+        alignas(internal::poly_align) u8 sbo_storage[Capacity];
+    } storage;
+
+    holder_base* holder = nullptr;
+    Interface* object = nullptr;
+};
+} // namespace sw
@@ -0,0 +1,415 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/memory.hpp"
+
+#if SW_ALLOC_TRACKING
+    #include "sw/alloc_tracker.hpp"
+#endif
+
+
+// 해제된 블록을 특정 패턴으로 채워 use-after-free를 검출합니다. (기본: 디버그 빌드에서만)
+#ifndef SW_POOL_POISON
+    #define SW_POOL_POISON SW_BUILD_DEBUG
+#endif
+
+namespace sw
+{
+namespace internal
+{
+// 스레드 로컬 매거진 하나에 담을 수 있는 블록 수
+constexpr usize pool_magazine_capacity = 64;
+
+// 청크 하나의 기본 크기
+constexpr usize pool_chunk_bytes = 64 * 1024;
+
+// 해제된 블록을 채우는 값
+constexpr u8 pool_poison_byte = 0xDD;
+
+/** 해제된 블록에 겹쳐 쓰는 침습형(intrusive) free list 노드 */
+struct pool_free_node
+{
+    pool_free_node* next;
+};
+
+/**
+ * 여러 스레드가 공유하는 블록 저장소
+ * 청크를 소유하며, 스레드 로컬 매거진과 블록을 묶음 단위로 주고받습니다.
+ */
+class pool_depot
+{
+public:
+    pool_depot(usize block_size, usize block_align) noexcept
+        : block_size(block_size)
+        , block_align(block_align)
+        , blocks_per_chunk(std::max<usize>(pool_chunk_bytes / block_size, 1))
+    {
+    }
+
+    ~pool_depot()
+    {
+        for (void* chunk : chunks)
+        {
+#if SW_ALLOC_TRACKING
+            alloc_tracker::deallocate<pool_depot>(chunk, block_size * blocks_per_chunk, block_align);
+#else
+            ::operator delete(chunk, block_size * blocks_per_chunk, std::align_val_t{ block_align });
+#endif
+        }
+    }
+
+    pool_depot(const pool_depot&) = delete;
+    pool_depot& operator=(const pool_depot&) = delete;
+
+    /** 최대 count개의 블록을 out에 채우고 채운 개수를 반환합니다. */
+    usize acquire(void** out, usize count)
+    {
+        std::scoped_lock lock{ mutex };
+        if (!free_list)
+        {
+            grow();
+        }
+
+        usize taken = 0;
+        while (taken < count && free_list)
+        {
+            out[taken++] = free_list;
+            free_list = free_list->next;
+        }
+        return taken;
+    }
+
+    /** count개의 블록을 공유 free list로 되돌립니다. */
+    void release(void* const* blocks, usize count) noexcept
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // 잠금 밖에서 체인을 만든 뒤 한 번에 연결
+        for (usize i = 0; i + 1 < count; ++i)
+        {
+            static_cast<pool_free_node*>(blocks[i])->next = static_cast<pool_free_node*>(blocks[i + 1]);
+        }
+        auto* head = static_cast<pool_free_node*>(blocks[0]);
+        auto* tail = static_cast<pool_free_node*>(blocks[count - 1]);
+
+        std::scoped_lock lock{ mutex };
+        tail->next = free_list;
+        free_list = head;
+    }
+
+    [[nodiscard]] usize chunk_count() const
+    {
+        std::scoped_lock lock{ mutex };
+        return chunks.size();
+    }
+
+public:
+    const usize block_size;
+    const usize block_align;
+    const usize blocks_per_chunk;
+
+private:
+    void grow()
+    {
+#if SW_ALLOC_TRACKING
+        auto* chunk = static_cast<u8*>(alloc_tracker::allocate<pool_depot>(block_size * blocks_per_chunk, block_align));
+#else
+        auto* chunk = static_cast<u8*>(::operator new(block_size * blocks_per_chunk, std::align_val_t{ block_align }));
+#endif
+        chunks.push_back(chunk);
+#if SW_POOL_POISON
+        std::memset(chunk, pool_poison_byte, block_size * blocks_per_chunk);
+#endif
+
+        // 청크 앞쪽 블록부터 나가도록 역순으로 연결
+        for (usize i = blocks_per_chunk; i-- > 0;)
+        {
+            auto* node = reinterpret_cast<pool_free_node*>(chunk + i * block_size);
+            node->next = free_list;
+            free_list = node;
+        }
+    }
+
+private:
+    mutable std::mutex mutex;
+    pool_free_node* free_list = nullptr;
+    std::vector<void*> chunks;
+};
+
+/** 스레드가 특정 depot에 대해 보관하는 블록 묶음 */
+struct pool_magazine
+{
+    std::shared_ptr<pool_depot> depot;
+    void* blocks[pool_magazine_capacity];
+    usize count = 0;
+
+    void flush() noexcept
+    {
+        depot->release(blocks, count);
+        count = 0;
+    }
+};
+
+/**
+ * pool_cache가 파괴되었는지 나타내는 플래그
+ * 자명한 소멸자를 가지므로 스레드 종료 중 다른 스레드 로컬/정적 객체의 소멸자에서도 안전하게 읽을 수 있습니다.
+ */
+inline thread_local bool pool_cache_destroyed = false;
+
+/**
+ * 스레드별 매거진 목록
+ * 스레드가 종료되면 남은 블록을 각 depot으로 되돌립니다.
+ * 매거진이 depot을 shared_ptr로 잡고 있으므로 pool이 먼저 파괴되어도 depot은 안전하게 유지됩니다.
+ */
+class pool_thread_cache
+{
+public:
+    ~pool_thread_cache()
+    {
+        for (auto& magazine : magazines)
+        {
+            magazine->flush();
+        }
+        pool_cache_destroyed = true;
+    }
+
+    pool_magazine& get(const std::shared_ptr<pool_depot>& depot)
+    {
+        if (last && last->depot == depot) [[likely]]
+        {
+            return *last;
+        }
+
+        const auto it = std::ranges::find(magazines, depot, [](const auto& m) { return m->depot; });
+        if (it != magazines.end())
+        {
+            last = it->get();
+        }
+        else
+        {
+            last = magazines.emplace_back(std::make_unique<pool_magazine>(depot)).get();
+        }
+        return *last;
+    }
+
+    /** depot에 대한 매거진을 비우고 목록에서 제거합니다. */
+    void detach(const pool_depot* depot) noexcept
+    {
+        const auto it = std::ranges::find(magazines, depot, [](const auto& m) { return m->depot.get(); });
+        if (it != magazines.end())
+        {
+            (*it)->flush();
+            if (last == it->get())
+            {
+                last = nullptr;
+            }
+            magazines.erase(it);
+        }
+    }
+
+private:
+    std::vector<std::unique_ptr<pool_magazine>> magazines;
+    pool_magazine* last = nullptr;
+};
+
+inline thread_local pool_thread_cache pool_cache;
+
+/**
+ * 현재 스레드에서 depot에 대한 매거진을 반환합니다.
+ * 스레드 캐시가 이미 파괴되었으면(정적 풀 소멸자, 늦게 파괴되는 스레드 로컬 객체) nullptr을 반환합니다.
+ */
+inline pool_magazine* thread_magazine(const std::shared_ptr<pool_depot>& depot)
+{
+    if (pool_cache_destroyed) [[unlikely]]
+    {
+        return nullptr;
+    }
+    return &pool_cache.get(depot);
+}
+} // namespace internal
+
+/**
+ * 고정 크기(Size) 블록 풀
+ * 각 스레드는 매거진에서 잠금 없이 블록을 꺼내고, 매거진이 비거나 가득 차면 공유 depot과 묶음 단위로 주고받습니다.
+ * 다른 스레드에서 할당한 블록을 해제해도 됩니다.
+ * @tparam Size 블록 크기
+ * @tparam Align 블록 정렬 (2의 거듭제곱이어야 함)
+ * @note 다른 스레드의 매거진에 남은 블록은 해당 스레드가 종료될 때 회수되며, 그때까지 청크 메모리가 유지됩니다.
+ */
+template <usize Size, usize Align = alignof(std::max_align_t)>
+    requires (Size > 0 && std::has_single_bit(Align))
+class fixed_pool
+{
+public:
+    static constexpr usize block_align = std::max(Align, alignof(internal::pool_free_node));
+    static constexpr usize block_size = aligned_size<block_align>(std::max(Size, sizeof(internal::pool_free_node)));
+
+public:
+    fixed_pool()
+        : depot(std::make_shared<internal::pool_depot>(block_size, block_align))
+    {
+    }
+
+    ~fixed_pool()
+    {
+        flush_thread_cache();
+    }
+
+    fixed_pool(const fixed_pool&) = delete;
+    fixed_pool& operator=(const fixed_pool&) = delete;
+
+public:
+    /** 블록 하나를 할당합니다. */
+    [[nodiscard]] void* allocate()
+    {
+        void* block = nullptr;
+        if (auto* magazine = internal::thread_magazine(depot)) [[likely]]
+        {
+            if (magazine->count == 0) [[unlikely]]
+            {
+                // 절반만 채워서 바로 다음 해제에서 depot으로 되돌아가지 않도록 함
+                magazine->count = depot->acquire(magazine->blocks, internal::pool_magazine_capacity / 2);
+            }
+            block = magazine->blocks[--magazine->count];
+        }
+        else
+        {
+            depot->acquire(&block, 1);
+        }
+
+#if SW_POOL_POISON
+        check_poison(block);
+#endif
+        return block;
+    }
+
+    /** 블록 하나를 해제합니다. */
+    void deallocate(void* block) noexcept
+    {
+        if (!block)
+        {
+            return;
+        }
+
+#if SW_POOL_POISON
+        std::memset(block, internal::pool_poison_byte, block_size);
+#endif
+
+        auto* magazine = internal::thread_magazine(depot);
+        if (!magazine) [[unlikely]]
+        {
+            depot->release(&block, 1);
+            return;
+        }
+
+        if (magazine->count == internal::pool_magazine_capacity) [[unlikely]]
+        {
+            // 오래된 절반을 depot으로 되돌림
+            constexpr usize half = internal::pool_magazine_capacity / 2;
+            depot->release(magazine->blocks, half);
+            std::ranges::copy(magazine->blocks + half, magazine->blocks + magazine->count, magazine->blocks);
+            magazine->count -= half;
+        }
+        magazine->blocks[magazine->count++] = block;
+    }
+
+    /** 현재 스레드의 매거진을 depot으로 되돌립니다. */
+    void flush_thread_cache() noexcept
+    {
+        if (!internal::pool_cache_destroyed)
+        {
+            internal::pool_cache.detach(depot.get());
+        }
+    }
+
+    /** 할당된 청크 수를 반환합니다. */
+    [[nodiscard]] usize chunk_count() const
+    {
+        return depot->chunk_count();
+    }
+
+private:
+#if SW_POOL_POISON
+    static void check_poison(const void* block) noexcept
+    {
+        // free list 링크가 쓰였을 수 있는 앞부분을 제외하고 확인
+        const auto* bytes = static_cast<const u8*>(block);
+        const bool intact = std::all_of(bytes + sizeof(internal::pool_free_node), bytes + block_size, [](u8 b)
+        {
+            return b == internal::pool_poison_byte;
+        });
+        assert(intact && "Pool block was modified after deallocate (use after free)");
+        (void)intact;
+    }
+#endif
+
+private:
+    std::shared_ptr<internal::pool_depot> depot;
+};
+
+/**
+ * T 타입 객체 전용 풀
+ *
+ * @code
+ * sw::object_pool<Node> pool;
+ * Node* node = pool.create(1, 2);
+ * pool.destroy(node);
+ * @endcode
+ */
+template <typename T>
+class object_pool
+{
+public:
+    /** 풀에서 T 객체를 생성합니다. */
+    template <typename... Args>
+    [[nodiscard]] T* create(Args&&... args)
+    {
+        void* block = pool.allocate();
+        try
+        {
+            return std::construct_at(static_cast<T*>(block), std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            pool.deallocate(block);
+            throw;
+        }
+    }
+
+    /** T 객체를 파괴하고 블록을 풀로 되돌립니다. */
+    void destroy(T* object) noexcept
+    {
+        if (object)
+        {
+            std::destroy_at(object);
+            pool.deallocate(object);
+        }
+    }
+
+    void flush_thread_cache() noexcept
+    {
+        pool.flush_thread_cache();
+    }
+
+    [[nodiscard]] usize chunk_count() const
+    {
+        return pool.chunk_count();
+    }
+
+private:
+    fixed_pool<sizeof(T), alignof(T)> pool;
+};
+} // namespace sw
@@ -0,0 +1,398 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/hash.hpp"
+
+#if SW_ARCH_X64 || SW_ARCH_X86
+    #if SW_COMPILER_MSVC
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+#endif
+
+
+// SW_PROFILE_SCOPE 계측 활성화 (기본: 꺼짐, 끄면 매크로가 아무 코드도 만들지 않음)
+#ifndef SW_PROFILING
+    #define SW_PROFILING false
+#endif
+
+namespace sw
+{
+namespace internal
+{
+/** 계측 지점 정보 (SW_PROFILE_SCOPE마다 정적 상수로 하나씩 생성) */
+struct profile_site
+{
+    std::string_view name;
+    u64 id; // 이름의 fnv1a 해시 (컴파일 타임 계산)
+};
+
+/** 구간 하나의 기록 */
+struct profile_event
+{
+    const profile_site* site;
+    u64 begin;
+    u64 end;
+};
+
+// 청크 하나에 담는 이벤트 수
+constexpr usize profile_chunk_events = 4096;
+
+/** 스레드 버퍼를 이루는 고정 크기 청크 */
+struct profile_chunk
+{
+    std::atomic<usize> count{ 0 };
+    std::atomic<profile_chunk*> next{ nullptr };
+    profile_event events[profile_chunk_events];
+};
+
+/**
+ * 스레드 하나의 이벤트 버퍼
+ * 소유 스레드만 쓰고, 내보내기는 청크별로 공개된 개수(count)까지만 읽습니다.
+ * 스레드가 종료되어도 기록은 남아 있도록 전역 저장소가 소유합니다.
+ */
+struct profile_thread_buffer
+{
+    explicit profile_thread_buffer(u32 thread_index)
+        : thread_index(thread_index)
+        , head(new profile_chunk)
+        , tail(head)
+    {
+    }
+
+    ~profile_thread_buffer()
+    {
+        free_chunks(head);
+    }
+
+    profile_thread_buffer(const profile_thread_buffer&) = delete;
+    profile_thread_buffer& operator=(const profile_thread_buffer&) = delete;
+
+    void push(const profile_event& event)
+    {
+        usize count = tail->count.load(std::memory_order_relaxed);
+        if (count == profile_chunk_events) [[unlikely]]
+        {
+            // clear() 이후에는 남겨 둔 청크를 재사용
+            profile_chunk* chunk = tail->next.load(std::memory_order_relaxed);
+            if (!chunk)
+            {
+                chunk = new profile_chunk;
+                tail->next.store(chunk, std::memory_order_release);
+            }
+            tail = chunk;
+            count = 0;
+        }
+        tail->events[count] = event;
+        tail->count.store(count + 1, std::memory_order_release);
+    }
+
+    /** 기록을 비웁니다. 청크는 해제하지 않고 재사용합니다. (기록 중인 구간이 없어야 함) */
+    void clear() noexcept
+    {
+        for (profile_chunk* chunk = head; chunk; chunk = chunk->next.load(std::memory_order_relaxed))
+        {
+            chunk->count.store(0, std::memory_order_release);
+        }
+        tail = head;
+    }
+
+    static void free_chunks(profile_chunk* chunk) noexcept
+    {
+        while (chunk)
+        {
+            profile_chunk* next = chunk->next.load(std::memory_order_relaxed);
+            delete chunk;
+            chunk = next;
+        }
+    }
+
+    const u32 thread_index;
+    profile_chunk* const head;
+    profile_chunk* tail;
+};
+
+/** 타임스탬프를 읽습니다. (x86/x64: rdtsc, 그 외: steady_clock) */
+SW_FORCE_INLINE u64 profile_timestamp() noexcept
+{
+#if SW_ARCH_X64 || SW_ARCH_X86
+    return __rdtsc();
+#else
+    return static_cast<u64>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/** 모든 스레드 버퍼와 시간 기준점을 보관하는 전역 저장소 */
+class profile_registry
+{
+public:
+    profile_registry()
+        : start_ticks(profile_timestamp())
+        , start_time(std::chrono::steady_clock::now())
+    {
+    }
+
+    [[nodiscard]] profile_thread_buffer* register_thread()
+    {
+        std::scoped_lock lock{ mutex };
+        const auto index = static_cast<u32>(buffers.size());
+        return buffers.emplace_back(std::make_unique<profile_thread_buffer>(index)).get();
+    }
+
+    template <typename Fn>
+    void for_each_buffer(Fn&& fn)
+    {
+        std::scoped_lock lock{ mutex };
+        for (auto& buffer : buffers)
+        {
+            fn(*buffer);
+        }
+    }
+
+    /** 타임스탬프 틱을 시작 시점 기준 나노초로 바꾸는 배율 (rdtsc는 steady_clock과 비교해 측정) */
+    [[nodiscard]] double nanoseconds_per_tick() const
+    {
+#if SW_ARCH_X64 || SW_ARCH_X86
+        const u64 ticks = profile_timestamp() - start_ticks;
+        const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start_time);
+        return ticks > 0 ? elapsed.count() / static_cast<double>(ticks) : 1.0;
+#else
+        using period = std::chrono::steady_clock::period;
+        return 1e9 * static_cast<double>(period::num) / static_cast<double>(period::den);
+#endif
+    }
+
+    const u64 start_ticks;
+    const std::chrono::steady_clock::time_point start_time;
+
+private:
+    std::mutex mutex;
+    std::vector<std::unique_ptr<profile_thread_buffer>> buffers;
+};
+
+[[nodiscard]] inline profile_registry& profiler_registry()
+{
+    static profile_registry instance;
+    return instance;
+}
+
+inline thread_local profile_thread_buffer* profile_buffer = nullptr;
+
+/** JSON 문자열 이스케이프 */
+inline void append_json_string(std::string& out, std::string_view text)
+{
+    out += '"';
+    for (const char c : text)
+    {
+        switch (c)
+        {
+        case '"':  out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (static_cast<u8>(c) < 0x20)
+            {
+                continue;
+            }
+            out += c;
+            break;
+        }
+    }
+    out += '"';
+}
+
+/** 나노초를 마이크로초 소수 3자리로 씁니다. (Chrome trace의 시간 단위) */
+inline void append_microseconds(std::string& out, u64 nanoseconds)
+{
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), nanoseconds / 1000);
+    out.append(buffer, result.ptr);
+
+    const u64 fraction = nanoseconds % 1000;
+    out += '.';
+    out += static_cast<char>('0' + fraction / 100);
+    out += static_cast<char>('0' + fraction / 10 % 10);
+    out += static_cast<char>('0' + fraction % 10);
+}
+} // namespace internal
+
+/**
+ * 구간(zone) 계측기
+ * 각 스레드는 자기 버퍼에 잠금 없이 이벤트를 추가하며, 기록은 Chrome trace JSON으로 내보낼 수 있습니다.
+ * (chrome://tracing, https://ui.perfetto.dev 에서 열 수 있음)
+ *
+ * @code
+ * void update()
+ * {
+ *     SW_PROFILE_SCOPE("update");
+ *     {
+ *         SW_PROFILE_SCOPE("physics");
+ *         step_physics();
+ *     }
+ * }
+ * sw::profiler::save_chrome_trace("trace.json");
+ * @endcode
+ */
+class profiler
+{
+public:
+    /** SW_PROFILE_SCOPE가 활성화되어 있는지 여부 */
+    static constexpr bool enabled = SW_PROFILING;
+
+public:
+    /** 현재 스레드에 구간 하나를 기록합니다. */
+    static void record(const internal::profile_site& site, u64 begin, u64 end)
+    {
+        internal::profile_thread_buffer* buffer = internal::profile_buffer;
+        if (!buffer) [[unlikely]]
+        {
+            buffer = internal::profile_buffer = internal::profiler_registry().register_thread();
+        }
+        buffer->push(internal::profile_event{ &site, begin, end });
+    }
+
+    /** 모든 스레드에 기록된 이벤트 수를 반환합니다. */
+    [[nodiscard]] static usize event_count()
+    {
+        usize total = 0;
+        internal::profiler_registry().for_each_buffer([&](internal::profile_thread_buffer& buffer)
+        {
+            for_each_chunk(buffer, [&](const internal::profile_chunk&, usize count) { total += count; });
+        });
+        return total;
+    }
+
+    /** 기록된 이벤트를 Chrome trace JSON 문자열로 만듭니다. */
+    [[nodiscard]] static std::string chrome_trace_json()
+    {
+        auto& registry = internal::profiler_registry();
+        const double ns_per_tick = registry.nanoseconds_per_tick();
+        const auto to_ns = [&](u64 ticks)
+        {
+            return static_cast<u64>(static_cast<double>(ticks - std::min(ticks, registry.start_ticks)) * ns_per_tick);
+        };
+
+        // 이름은 fnv1a id로 한 번만 이스케이프하여 재사용
+        std::unordered_map<u64, std::string> names;
+
+        std::string out = "{\"traceEvents\":[";
+        bool first = true;
+        registry.for_each_buffer([&](internal::profile_thread_buffer& buffer)
+        {
+            for_each_chunk(buffer, [&](const internal::profile_chunk& chunk, usize count)
+            {
+                for (usize i = 0; i < count; ++i)
+                {
+                    const auto& event = chunk.events[i];
+                    auto [it, inserted] = names.try_emplace(event.site->id);
+                    if (inserted)
+                    {
+                        internal::append_json_string(it->second, event.site->name);
+                    }
+
+                    const u64 begin = to_ns(event.begin);
+                    const u64 end = std::max(begin, to_ns(event.end));
+
+                    out += first ? "\n" : ",\n";
+                    first = false;
+                    out += "{\"name\":";
+                    out += it->second;
+                    out += ",\"ph\":\"X\",\"ts\":";
+                    internal::append_microseconds(out, begin);
+                    out += ",\"dur\":";
+                    internal::append_microseconds(out, end - begin);
+                    out += ",\"pid\":1,\"tid\":";
+                    out += std::to_string(buffer.thread_index);
+                    out += '}';
+                }
+            });
+        });
+        out += "\n],\"displayTimeUnit\":\"ns\"}\n";
+        return out;
+    }
+
+    /**
+     * Chrome trace JSON 파일로 저장합니다.
+     * @return 저장에 성공하면 true
+     */
+    static bool save_chrome_trace(const std::filesystem::path& path)
+    {
+        std::ofstream file{ path, std::ios::binary };
+        if (!file)
+        {
+            return false;
+        }
+        const std::string json = chrome_trace_json();
+        file.write(json.data(), static_cast<std::streamsize>(json.size()));
+        return static_cast<bool>(file);
+    }
+
+    /** 모든 기록을 지웁니다. 다른 스레드에서 구간을 기록하는 중이면 안 됩니다. */
+    static void clear()
+    {
+        internal::profiler_registry().for_each_buffer([](internal::profile_thread_buffer& buffer)
+        {
+            buffer.clear();
+        });
+    }
+
+private:
+    template <typename Fn>
+    static void for_each_chunk(const internal::profile_thread_buffer& buffer, Fn&& fn)
+    {
+        for (const internal::profile_chunk* chunk = buffer.head; chunk; chunk = chunk->next.load(std::memory_order_acquire))
+        {
+            fn(*chunk, chunk->count.load(std::memory_order_acquire));
+        }
+    }
+};
+
+/** 생성부터 소멸까지를 하나의 구간으로 기록하는 RAII 객체 */
+class profile_zone
+{
+public:
+    SW_FORCE_INLINE explicit profile_zone(const internal::profile_site& site) noexcept
+        : site(site)
+        , begin(internal::profile_timestamp())
+    {
+    }
+
+    SW_FORCE_INLINE ~profile_zone()
+    {
+        profiler::record(site, begin, internal::profile_timestamp());
+    }
+
+    profile_zone(const profile_zone&) = delete;
+    profile_zone& operator=(const profile_zone&) = delete;
+
+private:
+    const internal::profile_site& site;
+    u64 begin;
+};
+} // namespace sw
+
+// 현재 범위를 name(문자열 리터럴) 구간으로 기록
+#if SW_PROFILING
+    #define SW_PROFILE_SCOPE(name) SW_PROFILE_SCOPE_IMPL(name, SW_UNIQUE_NAME(sw_profile_site_), SW_UNIQUE_NAME(sw_profile_zone_))
+    #define SW_PROFILE_SCOPE_IMPL(name, site, zone) \
+        static constexpr ::sw::internal::profile_site site{ name, ::sw::fnv1a(name) }; \
+        const ::sw::profile_zone zone{ site }
+#else
+    #define SW_PROFILE_SCOPE(name) static_cast<void>(0)
+#endif
@@ -0,0 +1,396 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/memory.hpp"
+#include "sw/type_id.hpp"
+
+
+namespace sw
+{
+/**
+ * 직렬화 버퍼의 머리 (32바이트)
+ * 값은 실행 중인 플랫폼의 바이트 순서와 레이아웃 그대로 저장되므로, 같은 ABI끼리만 주고받을 수 있습니다.
+ */
+struct flat_header
+{
+    static constexpr std::array<char, 8> expected_magic{ 'S', 'W', 'F', 'L', 'A', 'T', '\0', '\1' };
+
+    std::array<char, 8> magic = expected_magic;
+    u64 schema = 0;      // type_id::get<T>().hash()
+    u64 size = 0;        // 머리를 포함한 전체 바이트 수
+    u64 root_offset = 0; // 루트 값의 위치
+};
+
+/** 버퍼 안의 가변 길이 배열 (버퍼 시작 기준 오프셋과 원소 수) */
+struct flat_array
+{
+    u64 offset = 0;
+    u64 count = 0;
+};
+
+namespace internal
+{
+template <typename T>
+concept flat_trivial = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && !std::is_member_pointer_v<T>;
+
+/**
+ * 레코드 필드 하나의 저장 방식
+ * 고정 길이 값은 그대로, 가변 길이 값(vector, string, span)은 flat_array 오프셋으로 저장합니다.
+ */
+template <typename T>
+struct flat_field
+{
+    static_assert(flat_trivial<T>, "flat serialization requires trivially copyable fields (or vector/string/span of them)");
+
+    static constexpr bool variable = false;
+    using stored_type = T;
+    using view_type = const T&;
+};
+
+template <typename T>
+struct flat_variable_field
+{
+    static_assert(flat_trivial<T>, "flat serialization requires trivially copyable array elements");
+
+    static constexpr bool variable = true;
+    using element_type = T;
+    using stored_type = flat_array;
+    using view_type = std::span<const T>;
+};
+
+template <typename T, typename Alloc>
+struct flat_field<std::vector<T, Alloc>> : flat_variable_field<T> {};
+
+template <typename T, usize Extent>
+struct flat_field<std::span<T, Extent>> : flat_variable_field<std::remove_const_t<T>> {};
+
+template <typename C, typename Traits>
+struct flat_field<std::basic_string_view<C, Traits>> : flat_variable_field<C>
+{
+    using view_type = std::basic_string_view<C, Traits>;
+};
+
+template <typename C, typename Traits, typename Alloc>
+struct flat_field<std::basic_string<C, Traits, Alloc>> : flat_field<std::basic_string_view<C, Traits>> {};
+
+template <typename T>
+concept flat_tuple_like = !flat_trivial<T> && requires { std::tuple_size<T>::value; };
+
+template <typename T>
+struct flat_record_traits;
+
+/** 레코드의 고정 영역: 필드를 선언 순서로 각자의 정렬에 맞춰 배치 */
+template <flat_tuple_like T>
+struct flat_record_traits<T>
+{
+    static constexpr usize field_count = std::tuple_size_v<T>;
+
+    template <usize I>
+    using field = flat_field<std::remove_cvref_t<std::tuple_element_t<I, T>>>;
+
+    static constexpr auto offsets = []<usize... I>(std::index_sequence<I...>)
+    {
+        std::array<usize, field_count + 1> result{};
+        usize offset = 0;
+        ((offset = aligned_size(offset, alignof(typename field<I>::stored_type)),
+          result[I] = offset,
+          offset += sizeof(typename field<I>::stored_type)), ...);
+        result[field_count] = offset;
+        return result;
+    }(std::make_index_sequence<field_count>{});
+
+    static constexpr usize alignment = []<usize... I>(std::index_sequence<I...>)
+    {
+        return std::max({ usize{ 1 }, alignof(typename field<I>::stored_type)... });
+    }(std::make_index_sequence<field_count>{});
+
+    static constexpr usize size = aligned_size(offsets[field_count], alignment);
+};
+
+template <typename T>
+struct flat_root_traits
+{
+    static constexpr usize size = sizeof(T);
+    static constexpr usize alignment = alignof(T);
+};
+
+template <flat_tuple_like T>
+struct flat_root_traits<T> : flat_record_traits<T> {};
+
+template <typename T>
+constexpr usize flat_root_offset = aligned_size(sizeof(flat_header), flat_root_traits<T>::alignment);
+
+template <usize I, typename T>
+decltype(auto) flat_get(const T& value)
+{
+    using std::get;
+    return get<I>(value);
+}
+} // namespace internal
+
+/** 직렬화할 수 있는 타입: trivially copyable 값, 또는 그런 필드/가변 길이 배열로 구성된 tuple-like 레코드 */
+template <typename T>
+concept flat_serializable = internal::flat_trivial<T> || internal::flat_tuple_like<T>;
+
+/** value를 직렬화한 크기 */
+template <flat_serializable T>
+[[nodiscard]] usize serialized_size(const T& value) noexcept
+{
+    usize size = internal::flat_root_offset<T> + internal::flat_root_traits<T>::size;
+    if constexpr (internal::flat_tuple_like<T>)
+    {
+        using traits = internal::flat_record_traits<T>;
+        [&]<usize... I>(std::index_sequence<I...>)
+        {
+            ([&]
+            {
+                using field = typename traits::template field<I>;
+                if constexpr (field::variable)
+                {
+                    const auto& source = internal::flat_get<I>(value);
+                    size = aligned_size(size, alignof(typename field::element_type));
+                    size += std::size(source) * sizeof(typename field::element_type);
+                }
+            }(), ...);
+        }(std::make_index_sequence<traits::field_count>{});
+    }
+    return size;
+}
+
+/**
+ * value를 out에 직렬화합니다. (mmap한 파일 등 외부 버퍼에 직접 쓸 때 사용)
+ * out은 flat_view<T>가 요구하는 정렬(루트/원소 타입의 최대 정렬)에 맞춰져 있어야 합니다.
+ * @return 기록한 바이트 수
+ * @throw std::length_error out이 serialized_size(value)보다 작은 경우
+ */
+template <flat_serializable T>
+usize serialize_to(const T& value, std::span<std::byte> out)
+{
+    const usize total = serialized_size(value);
+    if (out.size() < total)
+    {
+        throw std::length_error("serialize_to: output buffer is too small");
+    }
+
+    // 패딩까지 0으로 채워 같은 값은 항상 같은 바이트열이 되도록 함
+    std::memset(out.data(), 0, total);
+
+    flat_header header;
+    header.schema = type_id::get<T>().hash();
+    header.size = total;
+    header.root_offset = internal::flat_root_offset<T>;
+    std::memcpy(out.data(), &header, sizeof(header));
+
+    std::byte* root = out.data() + header.root_offset;
+    if constexpr (internal::flat_trivial<T>)
+    {
+        std::memcpy(root, &value, sizeof(T));
+    }
+    else
+    {
+        using traits = internal::flat_record_traits<T>;
+        usize tail = header.root_offset + traits::size;
+        [&]<usize... I>(std::index_sequence<I...>)
+        {
+            ([&]
+            {
+                using field = typename traits::template field<I>;
+                const auto& source = internal::flat_get<I>(value);
+                if constexpr (field::variable)
+                {
+                    using element = typename field::element_type;
+                    tail = aligned_size(tail, alignof(element));
+                    const flat_array array{ tail, static_cast<u64>(std::size(source)) };
+                    if (array.count > 0)
+                    {
+                        std::memcpy(out.data() + tail, std::data(source), array.count * sizeof(element));
+                    }
+                    std::memcpy(root + traits::offsets[I], &array, sizeof(array));
+                    tail += array.count * sizeof(element);
+                }
+                else
+                {
+                    std::memcpy(root + traits::offsets[I], &source, sizeof(source));
+                }
+            }(), ...);
+        }(std::make_index_sequence<traits::field_count>{});
+    }
+    return total;
+}
+
+/** value를 새 버퍼에 직렬화합니다. */
+template <flat_serializable T>
+[[nodiscard]] std::vector<std::byte> serialize(const T& value)
+{
+    std::vector<std::byte> buffer(serialized_size(value));
+    serialize_to(value, buffer);
+    return buffer;
+}
+
+/**
+ * 직렬화된 버퍼를 복사나 파싱 없이 제자리에서 읽는 뷰
+ * 생성 시 머리(magic, 스키마 해시, 크기)와 가변 길이 필드의 범위/정렬만 확인하고, 이후 접근은 포인터 계산뿐입니다.
+ * 버퍼는 뷰보다 오래 살아 있어야 합니다. (ecs의 sw::view와 구분하기 위해 flat_view로 명명)
+ *
+ * @code
+ * using snapshot = std::tuple<u64, std::vector<transform>, std::string>;
+ * auto bytes = sw::serialize(snapshot{ frame, transforms, "level1" });
+ *
+ * sw::flat_view<snapshot> view{ bytes };             // mmap한 파일도 그대로 사용 가능
+ * if (view) { std::span<const transform> t = view.get<1>(); }
+ * @endcode
+ */
+template <flat_serializable T>
+class flat_view
+{
+public:
+    flat_view() noexcept = default;
+
+    explicit flat_view(std::span<const std::byte> bytes) noexcept
+    {
+        if (validate(bytes))
+        {
+            buffer = bytes.first(static_cast<usize>(read_header(bytes).size));
+        }
+    }
+
+    /** 버퍼가 T의 직렬화 결과로 올바른지 여부 */
+    [[nodiscard]] bool is_valid() const noexcept { return !buffer.empty(); }
+    [[nodiscard]] explicit operator bool() const noexcept { return is_valid(); }
+
+    /** 유효한 경우 직렬화된 바이트 (머리 포함) */
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return buffer; }
+
+    /** 루트 값 (trivially copyable 타입) */
+    [[nodiscard]] const T& value() const noexcept
+        requires internal::flat_trivial<T>
+    {
+        return *root<T>();
+    }
+
+    [[nodiscard]] const T& operator*() const noexcept
+        requires internal::flat_trivial<T>
+    {
+        return value();
+    }
+
+    [[nodiscard]] const T* operator->() const noexcept
+        requires internal::flat_trivial<T>
+    {
+        return root<T>();
+    }
+
+    /**
+     * 레코드의 I번째 필드
+     * @return 고정 길이 필드는 const 참조, vector/span은 std::span<const E>, string은 std::basic_string_view
+     */
+    template <usize I>
+        requires internal::flat_tuple_like<T>
+    [[nodiscard]] decltype(auto) get() const noexcept
+    {
+        using traits = internal::flat_record_traits<T>;
+        using field = typename traits::template field<I>;
+        const std::byte* slot = buffer.data() + static_cast<usize>(read_header(buffer).root_offset) + traits::offsets[I];
+
+        if constexpr (field::variable)
+        {
+            flat_array array;
+            std::memcpy(&array, slot, sizeof(array));
+            const auto* first = std::launder(reinterpret_cast<const typename field::element_type*>(buffer.data() + array.offset));
+            return typename field::view_type{ first, static_cast<usize>(array.count) };
+        }
+        else
+        {
+            return *std::launder(reinterpret_cast<const typename field::stored_type*>(slot));
+        }
+    }
+
+private:
+    [[nodiscard]] static flat_header read_header(std::span<const std::byte> bytes) noexcept
+    {
+        flat_header header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        return header;
+    }
+
+    template <typename U>
+    [[nodiscard]] const U* root() const noexcept
+    {
+        return std::launder(reinterpret_cast<const U*>(buffer.data() + static_cast<usize>(read_header(buffer).root_offset)));
+    }
+
+    [[nodiscard]] static bool aligned_to(const std::byte* address, usize alignment) noexcept
+    {
+        return reinterpret_cast<usize>(address) % alignment == 0;
+    }
+
+    [[nodiscard]] static bool validate(std::span<const std::byte> bytes) noexcept
+    {
+        using root_traits = internal::flat_root_traits<T>;
+
+        if (bytes.size() < sizeof(flat_header) || !aligned_to(bytes.data(), root_traits::alignment))
+        {
+            return false;
+        }
+
+        const flat_header header = read_header(bytes);
+        if (header.magic != flat_header::expected_magic
+            || header.schema != type_id::get<T>().hash()
+            || header.size > bytes.size()
+            || header.root_offset != internal::flat_root_offset<T>
+            || header.root_offset + root_traits::size > header.size)
+        {
+            return false;
+        }
+
+        if constexpr (internal::flat_tuple_like<T>)
+        {
+            // 가변 길이 필드가 버퍼 안을 가리키고 원소 정렬을 지키는지 확인
+            using traits = internal::flat_record_traits<T>;
+            const std::byte* root = bytes.data() + header.root_offset;
+            return [&]<usize... I>(std::index_sequence<I...>)
+            {
+                return ([&]
+                {
+                    using field = typename traits::template field<I>;
+                    if constexpr (field::variable)
+                    {
+                        using element = typename field::element_type;
+                        flat_array array;
+                        std::memcpy(&array, root + traits::offsets[I], sizeof(array));
+                        return array.offset <= header.size
+                            && array.count <= (header.size - array.offset) / sizeof(element)
+                            && aligned_to(bytes.data() + array.offset, alignof(element));
+                    }
+                    else
+                    {
+                        return true;
+                    }
+                }() && ...);
+            }(std::make_index_sequence<traits::field_count>{});
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+private:
+    std::span<const std::byte> buffer;
+};
+} // namespace sw
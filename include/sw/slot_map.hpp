@@ -0,0 +1,233 @@
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "sw/types.hpp"
+
+
+namespace sw
+{
+/**
+ * slot_map이 발급하는 세대(generation) 태그 핸들
+ * Index가 u32이면 64비트, u16이면 32비트 핸들이 됩니다.
+ */
+template <std::unsigned_integral Index = u32>
+struct slot_handle
+{
+    /** 인덱스와 세대를 합친 정수 타입 */
+    using bits_type = std::conditional_t<sizeof(Index) <= 2, u32, u64>;
+
+    Index index = std::numeric_limits<Index>::max();
+    Index generation = 0;
+
+    [[nodiscard]] constexpr bool is_valid() const noexcept { return generation != 0; }
+    [[nodiscard]] explicit constexpr operator bool() const noexcept { return is_valid(); }
+    [[nodiscard]] constexpr bool operator==(const slot_handle&) const = default;
+
+    /** 핸들을 하나의 정수로 변환합니다. (직렬화, 외부 API 전달용) */
+    [[nodiscard]] constexpr bits_type to_bits() const noexcept
+    {
+        return (static_cast<bits_type>(generation) << (sizeof(Index) * 8)) | static_cast<bits_type>(index);
+    }
+
+    [[nodiscard]] static constexpr slot_handle from_bits(bits_type bits) noexcept
+    {
+        return slot_handle{
+            static_cast<Index>(bits),
+            static_cast<Index>(bits >> (sizeof(Index) * 8))
+        };
+    }
+};
+
+/**
+ * 세대 태그 핸들로 접근하는 연속 저장 컨테이너
+ * 값은 밀집 배열에 연속으로 저장되어 순회가 선형 스캔이 되고, 삽입/삭제(swap-and-pop)/조회가 모두 O(1)입니다.
+ * 핸들은 재할당이나 다른 원소의 삭제와 무관하게 유효하며, 삭제된 원소의 핸들은 세대 비교로 검출됩니다.
+ * @tparam T 값 타입
+ * @tparam Index 인덱스/세대 타입 (u32: 64비트 핸들, u16: 32비트 핸들)
+ *
+ * @code
+ * sw::slot_map<Texture> textures;
+ * auto handle = textures.emplace("grass.png");
+ * if (Texture* tex = textures.get(handle)) { ... }
+ * textures.erase(handle);
+ * textures.get(handle); // nullptr (stale handle)
+ * @endcode
+ */
+template <typename T, std::unsigned_integral Index = u32>
+class slot_map
+{
+public:
+    using handle_type = slot_handle<Index>;
+    using value_type = T;
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+private:
+    static constexpr Index npos = std::numeric_limits<Index>::max();
+
+    /**
+     * 희소 인덱스 슬롯
+     * 세대가 홀수이면 사용 중(value가 밀집 배열 위치), 짝수이면 비어 있음(value가 다음 빈 슬롯)
+     */
+    struct slot
+    {
+        Index value;
+        Index generation;
+    };
+
+public:
+    /** 값을 삽입하고 핸들을 반환합니다. */
+    handle_type insert(const T& value)
+    {
+        return emplace(value);
+    }
+
+    handle_type insert(T&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    /** 값을 제자리에서 생성하고 핸들을 반환합니다. */
+    template <typename... Args>
+    handle_type emplace(Args&&... args)
+    {
+        assert(values.size() < npos && "slot_map is full");
+
+        Index slot_index;
+        if (free_head != npos)
+        {
+            slot_index = free_head;
+        }
+        else
+        {
+            slot_index = static_cast<Index>(slots.size());
+            slots.push_back(slot{ npos, 0 });
+        }
+
+        values.emplace_back(std::forward<Args>(args)...);
+        dense_to_slot.push_back(slot_index);
+
+        slot& s = slots[slot_index];
+        if (slot_index == free_head)
+        {
+            free_head = s.value;
+        }
+        s.value = static_cast<Index>(values.size() - 1);
+        ++s.generation; // 짝수(빈 슬롯) -> 홀수(사용 중)
+        return handle_type{ slot_index, s.generation };
+    }
+
+    /** 핸들이 가리키는 값을 삭제합니다. 마지막 값이 빈자리로 옮겨집니다. */
+    bool erase(handle_type handle)
+    {
+        if (!contains(handle))
+        {
+            return false;
+        }
+
+        slot& s = slots[handle.index];
+        const Index dense_index = s.value;
+        const Index last_index = static_cast<Index>(values.size() - 1);
+        if (dense_index != last_index)
+        {
+            values[dense_index] = std::move(values[last_index]);
+            dense_to_slot[dense_index] = dense_to_slot[last_index];
+            slots[dense_to_slot[dense_index]].value = dense_index;
+        }
+        values.pop_back();
+        dense_to_slot.pop_back();
+
+        // 세대를 올려 기존 핸들을 무효화하고 빈 슬롯 목록에 추가
+        ++s.generation;
+        s.value = free_head;
+        free_head = handle.index;
+        return true;
+    }
+
+    /** 핸들이 살아 있는 값을 가리키는지 확인합니다. */
+    [[nodiscard]] bool contains(handle_type handle) const noexcept
+    {
+        return handle.index < slots.size()
+            && slots[handle.index].generation == handle.generation
+            && (handle.generation & 1) != 0;
+    }
+
+    /** 핸들이 가리키는 값을 반환합니다. 삭제되었거나 잘못된 핸들이면 nullptr을 반환합니다. */
+    [[nodiscard]] T* get(handle_type handle) noexcept
+    {
+        return contains(handle) ? &values[slots[handle.index].value] : nullptr;
+    }
+
+    [[nodiscard]] const T* get(handle_type handle) const noexcept
+    {
+        return contains(handle) ? &values[slots[handle.index].value] : nullptr;
+    }
+
+    /** 핸들이 가리키는 값을 반환합니다. (핸들이 유효해야 함) */
+    [[nodiscard]] T& operator[](handle_type handle) noexcept
+    {
+        assert(contains(handle) && "Stale or invalid slot_map handle");
+        return values[slots[handle.index].value];
+    }
+
+    [[nodiscard]] const T& operator[](handle_type handle) const noexcept
+    {
+        assert(contains(handle) && "Stale or invalid slot_map handle");
+        return values[slots[handle.index].value];
+    }
+
+    /** 밀집 배열 위치 i에 있는 값의 핸들을 반환합니다. */
+    [[nodiscard]] handle_type handle_at(usize i) const noexcept
+    {
+        const Index slot_index = dense_to_slot[i];
+        return handle_type{ slot_index, slots[slot_index].generation };
+    }
+
+    void clear() noexcept
+    {
+        // 세대를 유지한 채 모든 슬롯을 비워 기존 핸들이 모두 무효화되도록 함
+        for (const Index slot_index : dense_to_slot)
+        {
+            slot& s = slots[slot_index];
+            ++s.generation;
+            s.value = free_head;
+            free_head = slot_index;
+        }
+        values.clear();
+        dense_to_slot.clear();
+    }
+
+    void reserve(usize capacity)
+    {
+        values.reserve(capacity);
+        dense_to_slot.reserve(capacity);
+        slots.reserve(capacity);
+    }
+
+public:
+    [[nodiscard]] usize size() const noexcept { return values.size(); }
+    [[nodiscard]] bool empty() const noexcept { return values.empty(); }
+
+    /** 밀집 배열을 반환합니다. (순서는 삭제 시 바뀔 수 있음) */
+    [[nodiscard]] std::span<T> data() noexcept { return values; }
+    [[nodiscard]] std::span<const T> data() const noexcept { return values; }
+
+    [[nodiscard]] iterator begin() noexcept { return values.begin(); }
+    [[nodiscard]] iterator end() noexcept { return values.end(); }
+    [[nodiscard]] const_iterator begin() const noexcept { return values.begin(); }
+    [[nodiscard]] const_iterator end() const noexcept { return values.end(); }
+
+private:
+    std::vector<T> values;
+    std::vector<Index> dense_to_slot;
+    std::vector<slot> slots;
+    Index free_head = npos;
+};
+} // namespace sw
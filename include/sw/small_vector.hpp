@@ -0,0 +1,571 @@
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/memory.hpp"
+#include "sw/type_traits.hpp"
+
+
+namespace sw
+{
+/**
+ * 인라인 저장소를 갖는 가변 길이 배열
+ * N개 이하의 원소는 객체 내부 버퍼에 저장되어 힙 할당이 없고, 초과하면 Allocator로 힙에 옮겨 갑니다.
+ * trivially relocatable 타입은 성장/이동 시 memcpy로 옮깁니다. (sw::is_trivially_relocatable)
+ * @tparam T 원소 타입
+ * @tparam N 인라인 용량
+ * @tparam Allocator 힙 저장소에 사용할 할당자
+ *
+ * @code
+ * sw::small_vector<int, 8> values;
+ * for (int i = 0; i < 8; ++i) { values.push_back(i); } // 힙 할당 없음
+ * values.push_back(8);                                  // 힙으로 이동
+ * @endcode
+ */
+template <typename T, usize N, typename Allocator = std::allocator<T>>
+    requires (N > 0)
+class small_vector
+{
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = usize;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /** 인라인 버퍼에 저장할 수 있는 원소 수 */
+    static constexpr usize inline_capacity = N;
+
+private:
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+public:
+    small_vector() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+    explicit small_vector(const Allocator& alloc) noexcept
+        : alloc(alloc)
+    {
+    }
+
+    explicit small_vector(usize count, const Allocator& alloc = Allocator())
+        : alloc(alloc)
+    {
+        resize(count);
+    }
+
+    small_vector(usize count, const T& value, const Allocator& alloc = Allocator())
+        : alloc(alloc)
+    {
+        assign(count, value);
+    }
+
+    template <std::input_iterator InputIt>
+    small_vector(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+        : alloc(alloc)
+    {
+        assign(first, last);
+    }
+
+    small_vector(std::initializer_list<T> init, const Allocator& alloc = Allocator())
+        : alloc(alloc)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    small_vector(const small_vector& other)
+        : alloc(alloc_traits::select_on_container_copy_construction(other.alloc))
+    {
+        reserve(other.count);
+        std::uninitialized_copy_n(other.ptr, other.count, ptr);
+        count = other.count;
+    }
+
+    small_vector(small_vector&& other) noexcept(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>)
+        : alloc(std::move(other.alloc))
+    {
+        take(other);
+    }
+
+    ~small_vector()
+    {
+        std::destroy_n(ptr, count);
+        release_heap();
+    }
+
+    small_vector& operator=(const small_vector& other)
+    {
+        if (this != &other)
+        {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& other) noexcept(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            clear();
+            if (!other.is_inline() && alloc != other.alloc)
+            {
+                // 할당자가 다르면 힙 버퍼를 가져올 수 없으므로 원소 단위로 이동
+                reserve(other.count);
+                std::uninitialized_move_n(other.ptr, other.count, ptr);
+                count = other.count;
+                other.clear();
+                return *this;
+            }
+            release_heap();
+            take(other);
+        }
+        return *this;
+    }
+
+    small_vector& operator=(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+        return *this;
+    }
+
+public:
+    void assign(usize n, const T& value)
+    {
+        // value가 기존 원소를 참조할 수 있으므로 다 쓰기 전에는 원소를 파괴하지 않음
+        if (n > cap)
+        {
+            T* new_ptr = alloc_traits::allocate(alloc, n);
+            try
+            {
+                std::uninitialized_fill_n(new_ptr, n, value);
+            }
+            catch (...)
+            {
+                alloc_traits::deallocate(alloc, new_ptr, n);
+                throw;
+            }
+
+            clear();
+            release_heap();
+            ptr = new_ptr;
+            cap = n;
+        }
+        else if (n > count)
+        {
+            std::fill_n(ptr, count, value);
+            std::uninitialized_fill_n(ptr + count, n - count, value);
+        }
+        else
+        {
+            std::fill_n(ptr, n, value);
+            std::destroy_n(ptr + n, count - n);
+        }
+        count = n;
+    }
+
+    template <std::input_iterator InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        clear();
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            const auto n = static_cast<usize>(std::distance(first, last));
+            reserve(n);
+            std::uninitialized_copy(first, last, ptr);
+            count = n;
+        }
+        else
+        {
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+    }
+
+    void assign(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return alloc; }
+
+public:
+    [[nodiscard]] reference at(usize pos)
+    {
+        if (pos >= count)
+        {
+            throw std::out_of_range("sw::small_vector::at");
+        }
+        return ptr[pos];
+    }
+
+    [[nodiscard]] const_reference at(usize pos) const
+    {
+        if (pos >= count)
+        {
+            throw std::out_of_range("sw::small_vector::at");
+        }
+        return ptr[pos];
+    }
+
+    [[nodiscard]] reference operator[](usize pos) noexcept { return ptr[pos]; }
+    [[nodiscard]] const_reference operator[](usize pos) const noexcept { return ptr[pos]; }
+
+    [[nodiscard]] reference front() noexcept { return ptr[0]; }
+    [[nodiscard]] const_reference front() const noexcept { return ptr[0]; }
+
+    [[nodiscard]] reference back() noexcept { return ptr[count - 1]; }
+    [[nodiscard]] const_reference back() const noexcept { return ptr[count - 1]; }
+
+    [[nodiscard]] T* data() noexcept { return ptr; }
+    [[nodiscard]] const T* data() const noexcept { return ptr; }
+
+public:
+    [[nodiscard]] iterator begin() noexcept { return ptr; }
+    [[nodiscard]] const_iterator begin() const noexcept { return ptr; }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return ptr; }
+
+    [[nodiscard]] iterator end() noexcept { return ptr + count; }
+    [[nodiscard]] const_iterator end() const noexcept { return ptr + count; }
+    [[nodiscard]] const_iterator cend() const noexcept { return ptr + count; }
+
+    [[nodiscard]] reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    [[nodiscard]] reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    [[nodiscard]] const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+public:
+    [[nodiscard]] bool empty() const noexcept { return count == 0; }
+    [[nodiscard]] usize size() const noexcept { return count; }
+    [[nodiscard]] usize capacity() const noexcept { return cap; }
+    [[nodiscard]] usize max_size() const noexcept { return alloc_traits::max_size(alloc); }
+
+    /** 원소가 인라인 버퍼에 저장되어 있는지 확인합니다. */
+    [[nodiscard]] bool is_inline() const noexcept { return ptr == inline_data(); }
+
+    void reserve(usize new_capacity)
+    {
+        if (new_capacity > cap)
+        {
+            reallocate(new_capacity);
+        }
+    }
+
+    /** 힙에 있는 원소가 인라인 용량 이하이면 인라인 버퍼로 되돌리고, 아니면 용량을 크기에 맞춥니다. */
+    void shrink_to_fit()
+    {
+        if (is_inline() || count == cap)
+        {
+            return;
+        }
+
+        if (count <= N)
+        {
+            T* old_ptr = ptr;
+            const usize old_cap = cap;
+            relocate(old_ptr, count, inline_data());
+            alloc_traits::deallocate(alloc, old_ptr, old_cap);
+            ptr = inline_data();
+            cap = N;
+        }
+        else
+        {
+            reallocate(count);
+        }
+    }
+
+public:
+    void clear() noexcept
+    {
+        std::destroy_n(ptr, count);
+        count = 0;
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if (count == cap) [[unlikely]]
+        {
+            return grow_and_emplace_back(std::forward<Args>(args)...);
+        }
+
+        T* slot = std::construct_at(ptr + count, std::forward<Args>(args)...);
+        ++count;
+        return *slot;
+    }
+
+    void pop_back() noexcept
+    {
+        std::destroy_at(ptr + --count);
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        const auto index = static_cast<usize>(pos - ptr);
+        if (index == count)
+        {
+            emplace_back(std::forward<Args>(args)...);
+            return ptr + index;
+        }
+
+        // args가 원소를 참조할 수 있으므로 먼저 임시 객체를 만듦
+        T value(std::forward<Args>(args)...);
+        reserve(count + 1);
+
+        std::construct_at(ptr + count, std::move(ptr[count - 1]));
+        std::move_backward(ptr + index, ptr + count - 1, ptr + count);
+        ptr[index] = std::move(value);
+        ++count;
+        return ptr + index;
+    }
+
+    iterator insert(const_iterator pos, const T& value)
+    {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value)
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    iterator insert(const_iterator pos, usize n, const T& value)
+    {
+        // 뒤에 추가한 뒤 회전하여 제자리로 옮김
+        const auto index = static_cast<usize>(pos - ptr);
+        const usize old_count = count;
+        append_n(n, [&](T* dst) { std::uninitialized_fill_n(dst, n, value); });
+        std::rotate(ptr + index, ptr + old_count, ptr + count);
+        return ptr + index;
+    }
+
+    template <std::input_iterator InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        // 뒤에 추가한 뒤 회전하여 제자리로 옮김
+        const auto index = static_cast<usize>(pos - ptr);
+        const usize old_count = count;
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            const auto n = static_cast<usize>(std::distance(first, last));
+            append_n(n, [&](T* dst) { std::uninitialized_copy(first, last, dst); });
+        }
+        else
+        {
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+        std::rotate(ptr + index, ptr + old_count, ptr + count);
+        return ptr + index;
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<T> init)
+    {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        const auto index = static_cast<usize>(pos - ptr);
+        std::move(ptr + index + 1, ptr + count, ptr + index);
+        pop_back();
+        return ptr + index;
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        const auto index = static_cast<usize>(first - ptr);
+        const auto n = static_cast<usize>(last - first);
+        if (n > 0)
+        {
+            std::move(ptr + index + n, ptr + count, ptr + index);
+            std::destroy_n(ptr + count - n, n);
+            count -= n;
+        }
+        return ptr + index;
+    }
+
+    void resize(usize new_size)
+    {
+        if (new_size < count)
+        {
+            std::destroy_n(ptr + new_size, count - new_size);
+        }
+        else if (new_size > count)
+        {
+            reserve(new_size);
+            std::uninitialized_value_construct_n(ptr + count, new_size - count);
+        }
+        count = new_size;
+    }
+
+    void resize(usize new_size, const T& value)
+    {
+        if (new_size < count)
+        {
+            std::destroy_n(ptr + new_size, count - new_size);
+            count = new_size;
+        }
+        else if (new_size > count)
+        {
+            insert(end(), new_size - count, value);
+        }
+    }
+
+    void swap(small_vector& other) noexcept(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>)
+    {
+        small_vector temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+public:
+    [[nodiscard]] friend bool operator==(const small_vector& lhs, const small_vector& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    [[nodiscard]] friend auto operator<=>(const small_vector& lhs, const small_vector& rhs)
+        requires std::three_way_comparable<T>
+    {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+private:
+    [[nodiscard]] T* inline_data() noexcept { return reinterpret_cast<T*>(inline_buffer); }
+    [[nodiscard]] const T* inline_data() const noexcept { return reinterpret_cast<const T*>(inline_buffer); }
+
+    [[nodiscard]] usize next_capacity(usize required) const noexcept
+    {
+        return std::max(cap * 2, required);
+    }
+
+    /** n개의 원소를 src에서 dst로 옮기고 src의 원소를 파괴합니다. */
+    static void relocate(T* src, usize n, T* dst) noexcept(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>)
+    {
+        uninitialized_relocate_n(src, n, dst);
+    }
+
+    void reallocate(usize new_capacity)
+    {
+        T* new_ptr = alloc_traits::allocate(alloc, new_capacity);
+        relocate(ptr, count, new_ptr);
+        release_heap();
+        ptr = new_ptr;
+        cap = new_capacity;
+    }
+
+    template <typename... Args>
+    SW_NO_INLINE reference grow_and_emplace_back(Args&&... args)
+    {
+        grow_and_append(1, [&](T* dst) { std::construct_at(dst, std::forward<Args>(args)...); });
+        return ptr[count - 1];
+    }
+
+    /**
+     * 끝에 n개의 원소를 construct(dst)로 생성합니다.
+     * construct는 dst부터 n개를 모두 생성하거나, 던질 때 생성한 원소를 정리해야 합니다. (uninitialized_* 알고리즘)
+     */
+    template <typename Construct>
+    void append_n(usize n, Construct&& construct)
+    {
+        if (count + n > cap)
+        {
+            grow_and_append(n, construct);
+            return;
+        }
+        construct(ptr + count);
+        count += n;
+    }
+
+    /** 용량을 늘리며 끝에 n개의 원소를 추가합니다. */
+    template <typename Construct>
+    SW_NO_INLINE void grow_and_append(usize n, Construct&& construct)
+    {
+        const usize new_capacity = next_capacity(count + n);
+        T* new_ptr = alloc_traits::allocate(alloc, new_capacity);
+
+        // 인자가 기존 원소를 참조할 수 있으므로 새 원소를 먼저 생성한 뒤 기존 원소를 옮김
+        try
+        {
+            construct(new_ptr + count);
+        }
+        catch (...)
+        {
+            alloc_traits::deallocate(alloc, new_ptr, new_capacity);
+            throw;
+        }
+
+        relocate(ptr, count, new_ptr);
+        release_heap();
+        ptr = new_ptr;
+        cap = new_capacity;
+        count += n;
+    }
+
+    void release_heap() noexcept
+    {
+        if (!is_inline())
+        {
+            alloc_traits::deallocate(alloc, ptr, cap);
+        }
+    }
+
+    /** other의 원소를 가져옵니다. (this는 비어 있고 힙 버퍼가 없어야 함) */
+    void take(small_vector& other) noexcept(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>)
+    {
+        if (other.is_inline())
+        {
+            relocate(other.ptr, other.count, inline_data());
+            ptr = inline_data();
+            cap = N;
+        }
+        else
+        {
+            ptr = other.ptr;
+            cap = other.cap;
+            other.ptr = other.inline_data();
+            other.cap = N;
+        }
+        count = other.count;
+        other.count = 0;
+    }
+
+private:
+    T* ptr = inline_data();
+    usize count = 0;
+    usize cap = N;
+    SW_NO_UNIQUE_ADDRESS Allocator alloc;
+    alignas(T) std::byte inline_buffer[sizeof(T) * N];
+};
+} // namespace sw
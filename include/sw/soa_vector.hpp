@@ -0,0 +1,402 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/memory.hpp"
+#include "sw/tuple.hpp"
+#include "sw/type_list.hpp"
+
+
+namespace sw
+{
+/**
+ * 구조체 배열(AoS) 대신 필드마다 연속 배열(column)을 두는 가변 길이 컨테이너 (Structure of Arrays)
+ * 모든 column은 하나의 블록 안에 캐시 라인 경계로 정렬되어 배치되므로, 필드 하나만 읽는 반복문은
+ * 필요한 바이트만 순서대로 훑고 자동 벡터화되기 쉽습니다.
+ * soa_vector<std::tuple<Ts...>>는 soa_vector<Ts...>와 같습니다.
+ * @tparam Ts column 타입
+ *
+ * @code
+ * sw::soa_vector<vec3, vec3, float> particles; // position, velocity, lifetime
+ * particles.push_back({ position, velocity, 1.0f });
+ *
+ * for (float& lifetime : particles.column<2>()) { lifetime -= dt; } // lifetime column만 접근
+ * for (auto [position, velocity, lifetime] : particles) { position += velocity * dt; }
+ * @endcode
+ */
+template <typename... Ts>
+class soa_vector
+{
+    static_assert(sizeof...(Ts) > 0, "soa_vector requires at least one column");
+    static_assert((std::is_object_v<Ts> && ...) && (!std::is_const_v<Ts> && ...), "soa_vector columns must be non-const object types");
+
+public:
+    using value_type = std::tuple<Ts...>;
+    using reference = std::tuple<Ts&...>;
+    using const_reference = std::tuple<const Ts&...>;
+    using size_type = usize;
+    using difference_type = std::ptrdiff_t;
+    using column_types = type_list<Ts...>;
+
+    template <usize I>
+    using column_type = type_at_t<column_types, I>;
+
+    /** column 수 */
+    static constexpr usize column_count = sizeof...(Ts);
+
+    /** 각 column 시작 주소의 정렬 (캐시 라인 이상) */
+    static constexpr usize column_alignment = std::max({ cache_line_size, alignof(Ts)... });
+
+private:
+    template <bool Const>
+    class row_iterator
+    {
+        using owner_type = std::conditional_t<Const, const soa_vector, soa_vector>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = soa_vector::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, soa_vector::const_reference, soa_vector::reference>;
+
+        row_iterator() noexcept = default;
+
+        row_iterator(owner_type* owner, usize index) noexcept
+            : owner(owner)
+            , index(index)
+        {
+        }
+
+        [[nodiscard]] reference operator*() const noexcept { return (*owner)[index]; }
+
+        row_iterator& operator++() noexcept
+        {
+            ++index;
+            return *this;
+        }
+
+        row_iterator operator++(int) noexcept
+        {
+            row_iterator copy = *this;
+            ++index;
+            return copy;
+        }
+
+        [[nodiscard]] difference_type operator-(const row_iterator& other) const noexcept
+        {
+            return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+        }
+
+        [[nodiscard]] bool operator==(const row_iterator& other) const noexcept { return index == other.index; }
+
+    private:
+        owner_type* owner = nullptr;
+        usize index = 0;
+    };
+
+public:
+    using iterator = row_iterator<false>;
+    using const_iterator = row_iterator<true>;
+
+public:
+    soa_vector() noexcept = default;
+
+    explicit soa_vector(usize count)
+    {
+        resize(count);
+    }
+
+    soa_vector(const soa_vector& other)
+    {
+        reserve(other.count);
+        for (usize i = 0; i < other.count; ++i)
+        {
+            emplace_row(other[i]);
+        }
+    }
+
+    soa_vector(soa_vector&& other) noexcept
+        : columns(std::exchange(other.columns, {}))
+        , storage(std::exchange(other.storage, nullptr))
+        , count(std::exchange(other.count, 0))
+        , cap(std::exchange(other.cap, 0))
+    {
+    }
+
+    ~soa_vector()
+    {
+        clear();
+        release_storage();
+    }
+
+    soa_vector& operator=(const soa_vector& other)
+    {
+        if (this != &other)
+        {
+            soa_vector copy{ other };
+            swap(copy);
+        }
+        return *this;
+    }
+
+    soa_vector& operator=(soa_vector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            release_storage();
+            columns = std::exchange(other.columns, {});
+            storage = std::exchange(other.storage, nullptr);
+            count = std::exchange(other.count, 0);
+            cap = std::exchange(other.cap, 0);
+        }
+        return *this;
+    }
+
+    void swap(soa_vector& other) noexcept
+    {
+        std::swap(columns, other.columns);
+        std::swap(storage, other.storage);
+        std::swap(count, other.count);
+        std::swap(cap, other.cap);
+    }
+
+public:
+    /** 행 하나를 추가합니다. */
+    void push_back(const value_type& row)
+    {
+        emplace_row(row);
+    }
+
+    void push_back(value_type&& row)
+    {
+        emplace_row(std::move(row));
+    }
+
+    /** column마다 인자 하나씩 받아 행을 제자리에서 생성합니다. */
+    template <typename... Args>
+        requires (sizeof...(Args) == sizeof...(Ts) && (std::constructible_from<Ts, Args&&> && ...))
+    reference emplace_back(Args&&... args)
+    {
+        emplace_row(std::forward_as_tuple(std::forward<Args>(args)...));
+        return (*this)[count - 1];
+    }
+
+    /** 마지막 행을 제거합니다. */
+    void pop_back() noexcept
+    {
+        assert(count > 0 && "pop_back on empty soa_vector");
+        --count;
+        destroy_row(count);
+    }
+
+    /** index 행을 마지막 행으로 덮어쓰고 제거합니다. (순서 유지 안 함, O(1)) */
+    void swap_erase(usize index)
+    {
+        assert(index < count && "soa_vector index out of range");
+        if (index != count - 1)
+        {
+            for_each_column([&]<typename T>(T* column)
+            {
+                column[index] = std::move(column[count - 1]);
+            });
+        }
+        pop_back();
+    }
+
+    /** 행 수를 바꿉니다. 늘어난 행은 값 초기화됩니다. */
+    void resize(usize new_count)
+    {
+        while (count > new_count)
+        {
+            pop_back();
+        }
+        reserve(new_count);
+        while (count < new_count)
+        {
+            emplace_row(value_type{});
+        }
+    }
+
+    void reserve(usize new_capacity)
+    {
+        if (new_capacity > cap)
+        {
+            reallocate(new_capacity);
+        }
+    }
+
+    void clear() noexcept
+    {
+        for_each_column([&]<typename T>(T* column)
+        {
+            std::destroy_n(column, count);
+        });
+        count = 0;
+    }
+
+public:
+    /** I번째 column 전체 */
+    template <usize I>
+    [[nodiscard]] std::span<column_type<I>> column() noexcept
+    {
+        return { std::get<I>(columns), count };
+    }
+
+    template <usize I>
+    [[nodiscard]] std::span<const column_type<I>> column() const noexcept
+    {
+        return { std::get<I>(columns), count };
+    }
+
+    /** 타입 T인 column 전체 (T가 한 번만 나오는 경우) */
+    template <typename T>
+        requires ((std::is_same_v<T, Ts> + ...) == 1)
+    [[nodiscard]] std::span<T> column() noexcept
+    {
+        return column<index_of_v<column_types, T>>();
+    }
+
+    template <typename T>
+        requires ((std::is_same_v<T, Ts> + ...) == 1)
+    [[nodiscard]] std::span<const T> column() const noexcept
+    {
+        return column<index_of_v<column_types, T>>();
+    }
+
+    /** index 행의 필드 참조 묶음 */
+    [[nodiscard]] reference operator[](usize index) noexcept
+    {
+        assert(index < count && "soa_vector index out of range");
+        return std::apply([index](Ts*... column) { return reference{ column[index]... }; }, columns);
+    }
+
+    [[nodiscard]] const_reference operator[](usize index) const noexcept
+    {
+        assert(index < count && "soa_vector index out of range");
+        return std::apply([index](Ts*... column) { return const_reference{ column[index]... }; }, columns);
+    }
+
+    [[nodiscard]] reference front() noexcept { return (*this)[0]; }
+    [[nodiscard]] const_reference front() const noexcept { return (*this)[0]; }
+    [[nodiscard]] reference back() noexcept { return (*this)[count - 1]; }
+    [[nodiscard]] const_reference back() const noexcept { return (*this)[count - 1]; }
+
+    [[nodiscard]] iterator begin() noexcept { return { this, 0 }; }
+    [[nodiscard]] iterator end() noexcept { return { this, count }; }
+    [[nodiscard]] const_iterator begin() const noexcept { return { this, 0 }; }
+    [[nodiscard]] const_iterator end() const noexcept { return { this, count }; }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+    [[nodiscard]] usize size() const noexcept { return count; }
+    [[nodiscard]] usize capacity() const noexcept { return cap; }
+    [[nodiscard]] bool empty() const noexcept { return count == 0; }
+
+private:
+    /** capacity개 행을 담는 블록에서 각 column의 시작 오프셋과 전체 크기 */
+    [[nodiscard]] static std::array<usize, sizeof...(Ts) + 1> column_offsets(usize capacity) noexcept
+    {
+        std::array<usize, sizeof...(Ts) + 1> offsets{};
+        usize offset = 0;
+        usize i = 0;
+        ((offsets[i++] = offset, offset += aligned_size(capacity * sizeof(Ts), column_alignment)), ...);
+        offsets[sizeof...(Ts)] = offset;
+        return offsets;
+    }
+
+    template <typename Fn>
+    void for_each_column(Fn&& fn)
+    {
+        std::apply([&](Ts*... column) { (fn(column), ...); }, columns);
+    }
+
+    /** 행의 각 필드를 순서대로 생성하고, 중간에 예외가 나면 이미 생성한 필드를 파괴합니다. */
+    template <typename Row>
+    void emplace_row(Row&& row)
+    {
+        if (count == cap)
+        {
+            reallocate(std::max<usize>(cap * 2, 8));
+        }
+
+        [&]<usize... I>(std::index_sequence<I...>)
+        {
+            usize constructed = 0;
+            try
+            {
+                ((std::construct_at(std::get<I>(columns) + count, std::get<I>(std::forward<Row>(row))), ++constructed), ...);
+            }
+            catch (...)
+            {
+                ((I < constructed ? std::destroy_at(std::get<I>(columns) + count) : void()), ...);
+                throw;
+            }
+        }(std::index_sequence_for<Ts...>{});
+        ++count;
+    }
+
+    void destroy_row(usize index) noexcept
+    {
+        for_each_column([index]<typename T>(T* column)
+        {
+            std::destroy_at(column + index);
+        });
+    }
+
+    void reallocate(usize new_capacity)
+    {
+        const auto offsets = column_offsets(new_capacity);
+        auto* new_storage = static_cast<std::byte*>(::operator new(offsets.back(), std::align_val_t{ column_alignment }));
+
+        std::tuple<Ts*...> new_columns;
+        [&]<usize... I>(std::index_sequence<I...>)
+        {
+            ((std::get<I>(new_columns) = reinterpret_cast<column_type<I>*>(new_storage + offsets[I])), ...);
+            (uninitialized_relocate_n(std::get<I>(columns), count, std::get<I>(new_columns)), ...);
+        }(std::index_sequence_for<Ts...>{});
+
+        release_storage();
+        storage = new_storage;
+        columns = new_columns;
+        cap = new_capacity;
+    }
+
+    void release_storage() noexcept
+    {
+        if (storage)
+        {
+            ::operator delete(storage, column_offsets(cap).back(), std::align_val_t{ column_alignment });
+            storage = nullptr;
+        }
+    }
+
+private:
+    std::tuple<Ts*...> columns{};
+    std::byte* storage = nullptr;
+    usize count = 0;
+    usize cap = 0;
+};
+
+/** 튜플 타입으로 column을 지정합니다. (rebind_t로 soa_vector<Ts...>에 위임) */
+template <typename... Ts>
+class soa_vector<std::tuple<Ts...>> : public rebind_t<std::tuple<Ts...>, soa_vector>
+{
+    using base_type = rebind_t<std::tuple<Ts...>, soa_vector>;
+
+public:
+    using base_type::base_type;
+};
+} // namespace sw
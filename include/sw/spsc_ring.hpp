@@ -0,0 +1,509 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "sw/types.hpp"
+#include "sw/memory.hpp"
+
+
+namespace sw
+{
+namespace internal
+{
+/** 캐시 라인 정렬된 링 버퍼 저장소를 할당합니다. (크기는 캐시 라인 단위로 올림) */
+inline void* allocate_ring_storage(usize bytes, usize alignment)
+{
+    return ::operator new(aligned_size(bytes, alignment), std::align_val_t{ alignment });
+}
+
+inline void free_ring_storage(void* storage, usize bytes, usize alignment) noexcept
+{
+    ::operator delete(storage, aligned_size(bytes, alignment), std::align_val_t{ alignment });
+}
+
+/** 생산자 전용 상태: 쓰기 위치와 마지막으로 본 읽기 위치 */
+struct ring_producer_state
+{
+    std::atomic<usize> head{ 0 };
+    usize cached_tail = 0;
+};
+
+/** spsc_byte_ring 생산자 전용 상태: reserve와 commit 사이에 예약한 레코드 정보를 함께 둠 */
+struct byte_ring_producer_state : ring_producer_state
+{
+    usize pending_skip = 0;
+    usize pending_size = 0;
+};
+
+/** 소비자 전용 상태: 읽기 위치와 마지막으로 본 쓰기 위치 */
+struct ring_consumer_state
+{
+    std::atomic<usize> tail{ 0 };
+    usize cached_head = 0;
+};
+} // namespace internal
+
+/**
+ * 단일 생산자/단일 소비자(SPSC) 잠금 없는 링 버퍼
+ * 생산자와 소비자의 인덱스는 서로 다른 캐시 라인에 있고, 상대 인덱스를 캐시해 두었다가
+ * 캐시된 값으로 공간/데이터가 부족할 때만 상대 캐시 라인을 읽습니다.
+ * @tparam T 원소 타입
+ *
+ * @code
+ * sw::spsc_ring<Packet> ring{ 4096 };
+ * // I/O 스레드
+ * ring.write(std::span{ packets, count });
+ * // 파서 스레드
+ * Packet batch[64];
+ * usize n = ring.read(batch);
+ * @endcode
+ */
+template <typename T>
+class spsc_ring
+{
+private:
+    static constexpr usize storage_alignment = std::max(alignof(T), cache_line_size);
+
+public:
+    /** @param capacity 최소 용량 (2의 거듭제곱으로 올림) */
+    explicit spsc_ring(usize capacity)
+        : ring_capacity(std::bit_ceil(std::max<usize>(capacity, 2)))
+        , mask(ring_capacity - 1)
+        , slots(static_cast<T*>(internal::allocate_ring_storage(ring_capacity * sizeof(T), storage_alignment)))
+    {
+    }
+
+    ~spsc_ring()
+    {
+        const usize tail = consumer->tail.load(std::memory_order_relaxed);
+        const usize head = producer->head.load(std::memory_order_relaxed);
+        for (usize i = tail; i != head; ++i)
+        {
+            std::destroy_at(slots + (i & mask));
+        }
+        internal::free_ring_storage(slots, ring_capacity * sizeof(T), storage_alignment);
+    }
+
+    spsc_ring(const spsc_ring&) = delete;
+    spsc_ring& operator=(const spsc_ring&) = delete;
+
+public:
+    // -------------------------------------------------------------------------
+    // 생산자 API
+    // -------------------------------------------------------------------------
+
+    template <typename... Args>
+    bool try_emplace(Args&&... args)
+    {
+        const usize head = producer->head.load(std::memory_order_relaxed);
+        if (head - producer->cached_tail == ring_capacity)
+        {
+            producer->cached_tail = consumer->tail.load(std::memory_order_acquire);
+            if (head - producer->cached_tail == ring_capacity)
+            {
+                return false;
+            }
+        }
+
+        std::construct_at(slots + (head & mask), std::forward<Args>(args)...);
+        producer->head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const T& value)
+    {
+        return try_emplace(value);
+    }
+
+    bool try_push(T&& value)
+    {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+     * 가능한 만큼 values를 한 번에 씁니다.
+     * @return 실제로 쓴 원소 수
+     */
+    usize write(std::span<const T> values)
+    {
+        const usize head = producer->head.load(std::memory_order_relaxed);
+        usize free_space = ring_capacity - (head - producer->cached_tail);
+        if (free_space < values.size())
+        {
+            producer->cached_tail = consumer->tail.load(std::memory_order_acquire);
+            free_space = ring_capacity - (head - producer->cached_tail);
+        }
+
+        const usize n = std::min(free_space, values.size());
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        // 링 끝에서 잘리는 경우 두 구간으로 나눠 복사
+        const usize start = head & mask;
+        const usize first = std::min(n, ring_capacity - start);
+        copy_into(values.data(), first, slots + start);
+        copy_into(values.data() + first, n - first, slots);
+
+        producer->head.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    // -------------------------------------------------------------------------
+    // 소비자 API
+    // -------------------------------------------------------------------------
+
+    bool try_pop(T& out)
+    {
+        const usize tail = consumer->tail.load(std::memory_order_relaxed);
+        if (tail == consumer->cached_head)
+        {
+            consumer->cached_head = producer->head.load(std::memory_order_acquire);
+            if (tail == consumer->cached_head)
+            {
+                return false;
+            }
+        }
+
+        T* slot = slots + (tail & mask);
+        out = std::move(*slot);
+        std::destroy_at(slot);
+        consumer->tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    [[nodiscard]] std::optional<T> try_pop()
+    {
+        const usize tail = consumer->tail.load(std::memory_order_relaxed);
+        if (tail == consumer->cached_head)
+        {
+            consumer->cached_head = producer->head.load(std::memory_order_acquire);
+            if (tail == consumer->cached_head)
+            {
+                return std::nullopt;
+            }
+        }
+
+        T* slot = slots + (tail & mask);
+        std::optional<T> result{ std::move(*slot) };
+        std::destroy_at(slot);
+        consumer->tail.store(tail + 1, std::memory_order_release);
+        return result;
+    }
+
+    /**
+     * 가능한 만큼 out에 한 번에 읽어 옵니다.
+     * @return 실제로 읽은 원소 수
+     */
+    usize read(std::span<T> out)
+    {
+        const usize tail = consumer->tail.load(std::memory_order_relaxed);
+        usize available = consumer->cached_head - tail;
+        if (available < out.size())
+        {
+            consumer->cached_head = producer->head.load(std::memory_order_acquire);
+            available = consumer->cached_head - tail;
+        }
+
+        const usize n = std::min(available, out.size());
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        const usize start = tail & mask;
+        const usize first = std::min(n, ring_capacity - start);
+        move_out(slots + start, first, out.data());
+        move_out(slots, n - first, out.data() + first);
+
+        consumer->tail.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+public:
+    [[nodiscard]] usize capacity() const noexcept { return ring_capacity; }
+
+    /** 현재 원소 수를 반환합니다. (다른 스레드가 동작 중이면 근사값) */
+    [[nodiscard]] usize size() const noexcept
+    {
+        return producer->head.load(std::memory_order_acquire) - consumer->tail.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+private:
+    static void copy_into(const T* src, usize n, T* dst)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (n > 0)
+            {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+            }
+        }
+        else
+        {
+            std::uninitialized_copy_n(src, n, dst);
+        }
+    }
+
+    static void move_out(T* src, usize n, T* dst)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            if (n > 0)
+            {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+            }
+        }
+        else
+        {
+            std::move(src, src + n, dst);
+            std::destroy_n(src, n);
+        }
+    }
+
+private:
+    cache_padded<internal::ring_producer_state> producer;
+    cache_padded<internal::ring_consumer_state> consumer;
+
+    const usize ring_capacity;
+    const usize mask;
+    T* const slots;
+};
+
+/**
+ * 가변 길이 레코드용 SPSC 바이트 링 버퍼
+ * 생산자는 reserve()로 링 내부 공간을 직접 받아 쓰고 commit()으로 공개하며,
+ * 소비자는 peek()으로 받은 레코드를 그 자리에서 읽고 release()로 반납합니다. (복사 없음)
+ * 레코드는 8바이트 헤더(길이)와 함께 8바이트 단위로 정렬되며, 링 끝에 들어가지 않으면 처음으로 감습니다.
+ *
+ * @code
+ * sw::spsc_byte_ring ring{ 1 << 20 };
+ * // 생산자
+ * if (auto buf = ring.reserve(len); !buf.empty()) { std::memcpy(buf.data(), src, len); ring.commit(len); }
+ * // 소비자
+ * if (auto rec = ring.peek(); !rec.empty()) { parse(rec); ring.release(); }
+ * @endcode
+ */
+class spsc_byte_ring
+{
+private:
+    /** 레코드 헤더 */
+    struct record_header
+    {
+        u32 length;
+        u32 flags;
+    };
+
+    static constexpr usize record_alignment = alignof(u64);
+    static constexpr usize header_size = sizeof(record_header);
+    static constexpr u32 wrap_flag = 1; // 링 끝의 남은 공간을 건너뛰라는 표시
+
+public:
+    /** @param capacity 최소 바이트 용량 (2의 거듭제곱으로 올림) */
+    explicit spsc_byte_ring(usize capacity)
+        : ring_capacity(std::bit_ceil(std::max<usize>(capacity, 64)))
+        , mask(ring_capacity - 1)
+        , buffer(static_cast<std::byte*>(internal::allocate_ring_storage(ring_capacity, cache_line_size)))
+    {
+    }
+
+    ~spsc_byte_ring()
+    {
+        internal::free_ring_storage(buffer, ring_capacity, cache_line_size);
+    }
+
+    spsc_byte_ring(const spsc_byte_ring&) = delete;
+    spsc_byte_ring& operator=(const spsc_byte_ring&) = delete;
+
+public:
+    /** 한 레코드의 최대 크기 */
+    [[nodiscard]] usize max_record_size() const noexcept
+    {
+        return ring_capacity / 2 - header_size;
+    }
+
+    // -------------------------------------------------------------------------
+    // 생산자 API
+    // -------------------------------------------------------------------------
+
+    /**
+     * size 바이트 레코드를 쓸 공간을 예약합니다.
+     * @return 쓸 수 있는 연속 메모리 (공간이 부족하면 빈 span)
+     */
+    [[nodiscard]] std::span<std::byte> reserve(usize size)
+    {
+        assert(size <= max_record_size() && "Record is larger than spsc_byte_ring::max_record_size()");
+
+        const usize head = producer->head.load(std::memory_order_relaxed);
+        const usize offset = head & mask;
+        const usize total = record_size(size);
+        const usize to_end = ring_capacity - offset;
+
+        // 끝에 들어가지 않으면 남은 공간을 건너뛰고 처음부터 씀
+        const usize skip = (total > to_end) ? to_end : 0;
+        if (!has_space(head, skip + total))
+        {
+            return {};
+        }
+
+        if (skip > 0)
+        {
+            write_header(offset, 0, wrap_flag);
+        }
+        producer->pending_skip = skip;
+        producer->pending_size = size;
+
+        const usize record_offset = (head + skip) & mask;
+        return { buffer + record_offset + header_size, size };
+    }
+
+    /**
+     * reserve()로 받은 공간 중 used 바이트를 레코드로 공개합니다.
+     * @param used 실제로 쓴 크기 (reserve한 크기 이하)
+     */
+    void commit(usize used)
+    {
+        assert(used <= producer->pending_size && "Committed more bytes than reserved");
+
+        const usize head = producer->head.load(std::memory_order_relaxed);
+        const usize record_head = head + producer->pending_skip;
+        write_header(record_head & mask, static_cast<u32>(used), 0);
+        producer->head.store(record_head + record_size(used), std::memory_order_release);
+
+        producer->pending_skip = 0;
+        producer->pending_size = 0;
+    }
+
+    /** record를 복사하여 씁니다. 공간이 부족하면 false를 반환합니다. */
+    bool try_write(std::span<const std::byte> record)
+    {
+        const auto dest = reserve(record.size());
+        if (dest.data() == nullptr)
+        {
+            return false;
+        }
+        if (!record.empty())
+        {
+            std::memcpy(dest.data(), record.data(), record.size());
+        }
+        commit(record.size());
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // 소비자 API
+    // -------------------------------------------------------------------------
+
+    /**
+     * 다음 레코드를 반환합니다. release()를 호출하기 전까지 유효합니다.
+     * @return 레코드 데이터 (비어 있으면 data()가 nullptr)
+     */
+    [[nodiscard]] std::span<const std::byte> peek()
+    {
+        usize tail = consumer->tail.load(std::memory_order_relaxed);
+        while (true)
+        {
+            if (tail == consumer->cached_head)
+            {
+                consumer->cached_head = producer->head.load(std::memory_order_acquire);
+                if (tail == consumer->cached_head)
+                {
+                    return {};
+                }
+            }
+
+            const record_header header = read_header(tail & mask);
+            if (header.flags & wrap_flag)
+            {
+                // 링 끝의 빈 공간 건너뛰기
+                tail += ring_capacity - (tail & mask);
+                consumer->tail.store(tail, std::memory_order_release);
+                continue;
+            }
+
+            return { buffer + (tail & mask) + header_size, header.length };
+        }
+    }
+
+    /** peek()으로 받은 레코드를 반납합니다. */
+    void release()
+    {
+        const usize tail = consumer->tail.load(std::memory_order_relaxed);
+        const record_header header = read_header(tail & mask);
+        consumer->tail.store(tail + record_size(header.length), std::memory_order_release);
+    }
+
+    /** 다음 레코드가 있으면 fn(std::span<const std::byte>)을 호출하고 반납합니다. */
+    template <typename Fn>
+    bool try_read(Fn&& fn)
+    {
+        const auto record = peek();
+        if (record.data() == nullptr)
+        {
+            return false;
+        }
+        fn(record);
+        release();
+        return true;
+    }
+
+public:
+    [[nodiscard]] usize capacity() const noexcept { return ring_capacity; }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return producer->head.load(std::memory_order_acquire) == consumer->tail.load(std::memory_order_acquire);
+    }
+
+private:
+    [[nodiscard]] static constexpr usize record_size(usize payload) noexcept
+    {
+        return aligned_size<record_alignment>(header_size + payload);
+    }
+
+    [[nodiscard]] bool has_space(usize head, usize bytes)
+    {
+        if (ring_capacity - (head - producer->cached_tail) >= bytes)
+        {
+            return true;
+        }
+        producer->cached_tail = consumer->tail.load(std::memory_order_acquire);
+        return ring_capacity - (head - producer->cached_tail) >= bytes;
+    }
+
+    void write_header(usize offset, u32 length, u32 flags) noexcept
+    {
+        const record_header header{ length, flags };
+        std::memcpy(buffer + offset, &header, header_size);
+    }
+
+    [[nodiscard]] record_header read_header(usize offset) const noexcept
+    {
+        record_header header;
+        std::memcpy(&header, buffer + offset, header_size);
+        return header;
+    }
+
+private:
+    cache_padded<internal::byte_ring_producer_state> producer;
+    cache_padded<internal::ring_consumer_state> consumer;
+
+    const usize ring_capacity;
+    const usize mask;
+    std::byte* const buffer;
+};
+} // namespace sw
@@ -0,0 +1,401 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "sw/types.hpp"
+#include "sw/macros.hpp"
+#include "sw/function.hpp"
+#include "sw/slot_map.hpp"
+
+
+namespace sw
+{
+/** timer_wheel이 발급하는 타이머 핸들 (취소용, 만료/취소된 타이머는 세대 비교로 검출) */
+using timer_handle = slot_handle<u32>;
+
+/**
+ * 계층형 타이밍 휠 (hierarchical timing wheel)
+ * 각 단계(level)는 64개의 버킷을 갖고, 단계 L의 버킷 하나는 64^L 틱을 담당합니다. 먼 마감 시각의 타이머는 높은 단계에
+ * 들어갔다가 시간이 다가오면 낮은 단계로 내려오므로(cascade), 등록/취소는 정렬 없이 O(1)이고 만료 처리는 타이머당 상수 비용입니다.
+ * 단계마다 비어 있지 않은 버킷을 비트마스크로 관리하여 비어 있는 구간은 틱 단위로 돌지 않고 건너뜁니다.
+ *
+ * 콜백은 sw::function<void()>로 노드 풀(고정 크기 페이지, 빈 노드 목록)에 저장되며, 노드는 버킷의 침습형 이중 연결 리스트로 묶입니다.
+ * 틱의 단위(ms, us 등)는 호출자가 정하며, 단일 스레드에서 사용합니다.
+ *
+ * @code
+ * sw::timer_wheel timers;
+ * auto handle = timers.schedule_after(500, [] { retry(); });
+ * timers.cancel(handle);
+ * timers.advance(now_ms()); // 마감 시각이 지난 타이머의 콜백을 한꺼번에 실행
+ * @endcode
+ */
+class timer_wheel
+{
+public:
+    using callback_type = function<void()>;
+
+    static constexpr u32 level_bits = 6;
+    static constexpr u32 slots_per_level = 1u << level_bits;
+
+    /** u64 틱 전체를 담는 단계 수 (64^11 > 2^64) */
+    static constexpr u32 level_count = (64 + level_bits - 1) / level_bits;
+
+private:
+    static constexpr u32 npos = std::numeric_limits<u32>::max();
+    static constexpr u32 page_size = 4096;
+
+    // 버킷 번호: level * slots_per_level + slot
+    static constexpr u16 bucket_count = level_count * slots_per_level;
+    static constexpr u16 no_bucket = bucket_count;
+
+    struct node
+    {
+        callback_type callback;
+        u64 deadline = 0;
+        u32 prev = npos;
+        u32 next = npos;
+        u32 generation = 0; // 짝수: 빈 노드, 홀수: 사용 중
+        u16 bucket = no_bucket;
+    };
+
+    struct bucket_list
+    {
+        u32 head = npos;
+        u32 tail = npos;
+    };
+
+public:
+    /** @param start 현재 시각 (틱) */
+    explicit timer_wheel(u64 start = 0) noexcept
+        : current(start)
+    {
+    }
+
+    timer_wheel(const timer_wheel&) = delete;
+    timer_wheel& operator=(const timer_wheel&) = delete;
+    timer_wheel(timer_wheel&&) noexcept = default;
+    timer_wheel& operator=(timer_wheel&&) noexcept = default;
+
+public:
+    /**
+     * deadline 틱에 실행될 콜백을 등록합니다.
+     * 이미 지난 시각(deadline <= now())은 다음 틱(now() + 1)으로 올려, advance 안에서 자기 자신을 다시 등록해도 같은 틱에서 반복되지 않습니다.
+     */
+    template <typename Fn>
+        requires std::constructible_from<callback_type, Fn&&>
+    timer_handle schedule_at(u64 deadline, Fn&& callback)
+    {
+        const u32 index = allocate_node();
+        node& n = at(index);
+        try
+        {
+            n.callback = callback_type{ std::forward<Fn>(callback) };
+        }
+        catch (...)
+        {
+            free_node(index);
+            throw;
+        }
+
+        n.deadline = deadline > current ? deadline : current + 1;
+        place(index);
+        ++count;
+        return timer_handle{ index, n.generation };
+    }
+
+    /** 지금부터 delay 틱 뒤에 실행될 콜백을 등록합니다. */
+    template <typename Fn>
+        requires std::constructible_from<callback_type, Fn&&>
+    timer_handle schedule_after(u64 delay, Fn&& callback)
+    {
+        const u64 deadline = delay > std::numeric_limits<u64>::max() - current ? std::numeric_limits<u64>::max() : current + delay;
+        return schedule_at(deadline, std::forward<Fn>(callback));
+    }
+
+    /** 아직 실행되지 않은 타이머를 취소합니다. (O(1)) @return 취소했으면 true, 이미 실행/취소된 핸들이면 false */
+    bool cancel(timer_handle handle) noexcept
+    {
+        if (!contains(handle))
+        {
+            return false;
+        }
+
+        unlink(handle.index);
+        free_node(handle.index);
+        --count;
+        return true;
+    }
+
+    /** 핸들이 아직 실행되지 않은 타이머를 가리키는지 확인합니다. */
+    [[nodiscard]] bool contains(timer_handle handle) const noexcept
+    {
+        return handle.index < allocated
+            && at(handle.index).generation == handle.generation
+            && (handle.generation & 1) != 0;
+    }
+
+    /** 핸들이 가리키는 타이머의 마감 시각 */
+    [[nodiscard]] std::optional<u64> deadline(timer_handle handle) const noexcept
+    {
+        if (!contains(handle))
+        {
+            return std::nullopt;
+        }
+        return at(handle.index).deadline;
+    }
+
+    /**
+     * 시각을 now까지 진행하며 마감 시각이 now 이하인 타이머의 콜백을 마감 시각 순서로 실행합니다.
+     * 같은 틱에 만료된 타이머들은 level 0 버킷 하나에 모여 있으므로 버킷을 앞에서부터 비우며 한꺼번에 실행하고,
+     * 콜백 안에서 다른 타이머를 등록/취소해도 됩니다. 콜백이 예외를 던지면 남은 타이머는 다음 advance에서 실행됩니다.
+     * @return 실행한 콜백 수
+     */
+    usize advance(u64 now)
+    {
+        usize fired = 0;
+        while (true)
+        {
+            const auto next = next_bucket();
+            if (!next || next->time > now)
+            {
+                break;
+            }
+
+            current = next->time;
+            if (next->level == 0)
+            {
+                // level 0 버킷의 타이머는 모두 current에 만료됨
+                fired += fire_bucket(next->bucket);
+            }
+            else
+            {
+                cascade(next->bucket);
+            }
+        }
+
+        if (now > current)
+        {
+            current = now;
+        }
+        return fired;
+    }
+
+    /**
+     * 가장 이른 만료 시각의 하한 (타이머가 없으면 nullopt)
+     * 가장 가까운 타이머가 높은 단계에 있으면 해당 버킷의 시작 시각을 반환하므로, 이벤트 루프는 이 시각까지 잠들었다가 advance하면 됩니다.
+     */
+    [[nodiscard]] std::optional<u64> next_expiry() const noexcept
+    {
+        const auto next = next_bucket();
+        if (!next)
+        {
+            return std::nullopt;
+        }
+        return next->time;
+    }
+
+    /** 모든 타이머를 실행하지 않고 제거합니다. */
+    void clear() noexcept
+    {
+        for (u32 i = 0; i < allocated; ++i)
+        {
+            node& n = at(i);
+            if (n.generation & 1)
+            {
+                n.bucket = no_bucket;
+                free_node(i);
+            }
+        }
+        buckets = {};
+        occupied = {};
+        count = 0;
+    }
+
+    /** 현재 시각 (틱) */
+    [[nodiscard]] u64 now() const noexcept { return current; }
+
+    /** 실행 대기 중인 타이머 수 */
+    [[nodiscard]] usize size() const noexcept { return count; }
+    [[nodiscard]] bool empty() const noexcept { return count == 0; }
+
+private:
+    struct bucket_position
+    {
+        u64 time;
+        u32 level;
+        u16 bucket;
+    };
+
+    [[nodiscard]] node& at(u32 index) noexcept
+    {
+        return pages[index / page_size][index % page_size];
+    }
+
+    [[nodiscard]] const node& at(u32 index) const noexcept
+    {
+        return pages[index / page_size][index % page_size];
+    }
+
+    [[nodiscard]] u32 allocate_node()
+    {
+        u32 index;
+        if (free_head != npos)
+        {
+            index = free_head;
+            free_head = at(index).next;
+        }
+        else
+        {
+            assert(allocated < npos && "timer_wheel is full");
+            if (allocated == pages.size() * page_size)
+            {
+                pages.push_back(std::make_unique<node[]>(page_size));
+            }
+            index = allocated++;
+        }
+
+        ++at(index).generation; // 짝수(빈 노드) -> 홀수(사용 중)
+        return index;
+    }
+
+    /** 콜백을 파괴하고 세대를 올려 기존 핸들을 무효화한 뒤 빈 노드 목록에 넣습니다. */
+    void free_node(u32 index) noexcept
+    {
+        node& n = at(index);
+        n.callback = nullptr;
+        n.bucket = no_bucket;
+        ++n.generation;
+        n.prev = npos;
+        n.next = free_head;
+        free_head = index;
+    }
+
+    /**
+     * 마감 시각과 현재 시각이 처음 달라지는 비트 묶음이 단계, 그 단계의 마감 시각 비트가 버킷
+     * (마감 시각이 현재 시각이면 level 0의 현재 버킷에 들어가 이번 advance에서 실행됨)
+     */
+    void place(u32 index) noexcept
+    {
+        const u64 deadline = at(index).deadline;
+        assert(deadline >= current);
+
+        const u64 diff = deadline ^ current;
+        const u32 level = diff == 0 ? 0 : static_cast<u32>(63 - std::countl_zero(diff)) / level_bits;
+        const u32 slot = static_cast<u32>(deadline >> (level * level_bits)) & (slots_per_level - 1);
+        push_back(static_cast<u16>(level * slots_per_level + slot), index);
+        occupied[level] |= u64{ 1 } << slot;
+    }
+
+    void push_back(u16 bucket, u32 index) noexcept
+    {
+        node& n = at(index);
+        bucket_list& list = buckets[bucket];
+        n.bucket = bucket;
+        n.prev = list.tail;
+        n.next = npos;
+        if (list.tail != npos)
+        {
+            at(list.tail).next = index;
+        }
+        else
+        {
+            list.head = index;
+        }
+        list.tail = index;
+    }
+
+    void unlink(u32 index) noexcept
+    {
+        node& n = at(index);
+        bucket_list& list = buckets[n.bucket];
+        (n.prev != npos ? at(n.prev).next : list.head) = n.next;
+        (n.next != npos ? at(n.next).prev : list.tail) = n.prev;
+
+        if (list.head == npos)
+        {
+            occupied[n.bucket / slots_per_level] &= ~(u64{ 1 } << (n.bucket % slots_per_level));
+        }
+    }
+
+    /** 현재 시각 이후 가장 먼저 처리할 버킷 (낮은 단계의 버킷이 항상 더 이름) */
+    [[nodiscard]] std::optional<bucket_position> next_bucket() const noexcept
+    {
+        for (u32 level = 0; level < level_count; ++level)
+        {
+            const u32 shift = level * level_bits;
+            const u32 current_slot = static_cast<u32>(current >> shift) & (slots_per_level - 1);
+            const u64 candidates = occupied[level] & (~u64{ 0 } << current_slot);
+            if (candidates == 0)
+            {
+                continue;
+            }
+
+            const u32 slot = static_cast<u32>(std::countr_zero(candidates));
+            const u32 upper_shift = shift + level_bits;
+            const u64 base = upper_shift >= 64 ? 0 : current & ~((u64{ 1 } << upper_shift) - 1);
+            const u64 start = base + (static_cast<u64>(slot) << shift);
+            return bucket_position{ start > current ? start : current, level, static_cast<u16>(level * slots_per_level + slot) };
+        }
+        return std::nullopt;
+    }
+
+    /** 높은 단계 버킷의 타이머를 현재 시각(버킷 시작 시각) 기준으로 낮은 단계에 다시 배치합니다. */
+    void cascade(u16 bucket) noexcept
+    {
+        u32 index = buckets[bucket].head;
+        buckets[bucket] = {};
+        occupied[bucket / slots_per_level] &= ~(u64{ 1 } << (bucket % slots_per_level));
+
+        while (index != npos)
+        {
+            const u32 next = at(index).next;
+            place(index);
+            index = next;
+        }
+    }
+
+    /**
+     * level 0 버킷의 타이머를 앞에서부터 하나씩 꺼내 실행합니다.
+     * 콜백이 등록하는 타이머는 마감 시각이 current보다 뒤이므로 이 버킷에 들어오지 않습니다.
+     */
+    usize fire_bucket(u16 bucket)
+    {
+        usize fired = 0;
+        bucket_list& list = buckets[bucket];
+        while (list.head != npos)
+        {
+            const u32 index = list.head;
+            unlink(index);
+
+            // 콜백 안에서는 자신의 핸들이 이미 무효이고 노드를 바로 재사용할 수 있도록, 콜백을 꺼낸 뒤 노드를 먼저 반환
+            callback_type callback = std::move(at(index).callback);
+            free_node(index);
+            --count;
+
+            callback();
+            ++fired;
+        }
+        return fired;
+    }
+
+private:
+    std::vector<std::unique_ptr<node[]>> pages;
+    u32 allocated = 0;
+    u32 free_head = npos;
+
+    std::array<bucket_list, bucket_count> buckets{};
+    std::array<u64, level_count> occupied{};
+
+    u64 current = 0;
+    usize count = 0;
+};
+} // namespace sw
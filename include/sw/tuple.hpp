@@ -4,6 +4,8 @@
 #include <type_traits>
 #include <utility>
 
+#include "sw/type_list.hpp"
+
 
 namespace sw
 {
@@ -60,18 +62,18 @@ struct rebind_impl<R(Ts...)>
 template <typename... Tuples>
 using tuple_cat_t = decltype(std::tuple_cat(std::declval<Tuples>()...));
 
-template <template <typename...> typename ResultTuple, typename T>
+template <typename T>
 struct flatten_impl
 {
-    // 튜플이 아니면 그대로 튜플로 감싸서 반환
-    using type = ResultTuple<T>;
+    // 튜플이 아니면 그대로 목록으로 감싸서 반환
+    using type = type_list<T>;
 };
 
-template <template <typename...> typename ResultTuple, template <typename...> typename InputTuple, typename... Ts>
-struct flatten_impl<ResultTuple, InputTuple<Ts...>>
+template <template <typename...> typename InputTuple, typename... Ts>
+struct flatten_impl<InputTuple<Ts...>>
 {
-    // 내부 요소들을 flatten 하고, 그 결과 타입들을 tuple_cat으로 합침
-    using type = tuple_cat_t<typename flatten_impl<ResultTuple, Ts>::type...>;
+    // 내부 요소들을 flatten 하고, 그 결과를 type_list로 이어 붙임 (std::tuple 인스턴스화 없음)
+    using type = concat_t<typename flatten_impl<Ts>::type...>;
 };
 } // namespace internal
 
@@ -121,5 +123,5 @@ using tuple_cat_t = internal::tuple_cat_t<Tuples...>;
  * @endcode
  */
 template <typename T, template <typename...> typename ResultTupleLike = std::tuple>
-using flatten_tuple_t = internal::flatten_impl<ResultTupleLike, T>::type;
+using flatten_tuple_t = rebind_t<typename internal::flatten_impl<T>::type, ResultTupleLike>;
 } // namespace sw
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <array>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "sw/types.hpp"
+
+#if defined(__has_builtin)
+    #if __has_builtin(__type_pack_element)
+        #define SW_HAS_TYPE_PACK_ELEMENT 1
+    #endif
+#endif
+
+
+namespace sw
+{
+/**
+ * 타입 목록 (값이 없는 순수 타입 컨테이너)
+ * std::tuple과 달리 멤버를 갖지 않으므로 인스턴스화 비용이 거의 없고, 아래 알고리즘은 모두 목록 길이와 관계없이
+ * 템플릿 인스턴스화 깊이가 일정하도록(재귀 없이 팩 확장, fold, constexpr 배열로) 구현되어 있습니다.
+ *
+ * @code
+ * using components = sw::type_list<position, velocity, position, health>;
+ * using unique = sw::unique_t<components>;                           // type_list<position, velocity, health>
+ * constexpr usize index = sw::index_of_v<unique, health>;            // 2
+ * using floats = sw::filter_t<sw::type_list<int, float, double>, std::is_floating_point>; // type_list<float, double>
+ * @endcode
+ */
+template <typename... Ts>
+struct type_list
+{
+    static constexpr usize size = sizeof...(Ts);
+};
+
+/** 목록에 타입이 없을 때 index_of_v 등이 반환하는 값 */
+inline constexpr usize type_npos = std::numeric_limits<usize>::max();
+
+namespace internal
+{
+// -----------------------------------------------------------------------------
+// 인덱스 접근: 컴파일러 내장 함수가 있으면 사용하고, 없으면 다중 상속 + 오버로드 해석으로 한 번에 선택
+// (C++26 팩 인덱싱 Ts...[I]를 지원하지 않는 컴파일러용)
+// -----------------------------------------------------------------------------
+#ifdef SW_HAS_TYPE_PACK_ELEMENT
+template <usize I, typename... Ts>
+using pack_element_t = __type_pack_element<I, Ts...>;
+#else
+template <usize I, typename T>
+struct indexed_type
+{
+    using type = T;
+};
+
+template <typename Indices, typename... Ts>
+struct indexed_types;
+
+template <usize... I, typename... Ts>
+struct indexed_types<std::index_sequence<I...>, Ts...> : indexed_type<I, Ts>...
+{
+};
+
+template <usize I, typename T>
+indexed_type<I, T> select_indexed(const indexed_type<I, T>&);
+
+template <usize I, typename... Ts>
+using pack_element_t = typename decltype(select_indexed<I>(
+    std::declval<indexed_types<std::index_sequence_for<Ts...>, Ts...>>()))::type;
+#endif
+
+template <usize I, typename List>
+struct type_at_impl;
+
+template <usize I, typename... Ts>
+struct type_at_impl<I, type_list<Ts...>>
+{
+    static_assert(I < sizeof...(Ts), "type_list index out of range");
+    using type = pack_element_t<I, Ts...>;
+};
+
+// -----------------------------------------------------------------------------
+// 검색: 비교 결과를 constexpr 배열로 펼친 뒤 반복문으로 찾음
+// -----------------------------------------------------------------------------
+template <usize N>
+consteval usize first_true(const std::array<bool, N>& matches) noexcept
+{
+    for (usize i = 0; i < N; ++i)
+    {
+        if (matches[i])
+        {
+            return i;
+        }
+    }
+    return type_npos;
+}
+
+template <typename List, typename T>
+struct index_of_impl;
+
+template <typename... Ts, typename T>
+struct index_of_impl<type_list<Ts...>, T>
+{
+    static constexpr usize value = first_true(std::array<bool, sizeof...(Ts)>{ std::is_same_v<T, Ts>... });
+};
+
+template <typename List, template <typename> typename Pred>
+struct find_if_impl;
+
+template <typename... Ts, template <typename> typename Pred>
+struct find_if_impl<type_list<Ts...>, Pred>
+{
+    static constexpr usize value = first_true(std::array<bool, sizeof...(Ts)>{ static_cast<bool>(Pred<Ts>::value)... });
+};
+
+// -----------------------------------------------------------------------------
+// 선택: 남길 인덱스를 constexpr 배열로 계산한 뒤 한 번의 팩 확장으로 새 목록 생성
+// -----------------------------------------------------------------------------
+template <usize N>
+struct selected_indices
+{
+    std::array<usize, N> indices{};
+    usize count = 0;
+};
+
+template <usize N>
+consteval selected_indices<N> select_true(const std::array<bool, N>& keep) noexcept
+{
+    selected_indices<N> result;
+    for (usize i = 0; i < N; ++i)
+    {
+        if (keep[i])
+        {
+            result.indices[result.count++] = i;
+        }
+    }
+    return result;
+}
+
+template <typename List, auto Selected, typename Sequence>
+struct pick_impl;
+
+template <typename... Ts, auto Selected, usize... J>
+struct pick_impl<type_list<Ts...>, Selected, std::index_sequence<J...>>
+{
+    using type = type_list<pack_element_t<Selected.indices[J], Ts...>...>;
+};
+
+/** keep[i]가 true인 요소만 순서대로 남깁니다. */
+template <typename List, std::array Keep>
+using pick_t = typename pick_impl<List, select_true(Keep), std::make_index_sequence<select_true(Keep).count>>::type;
+
+template <typename List, template <typename> typename Pred>
+struct filter_impl;
+
+template <typename... Ts, template <typename> typename Pred>
+struct filter_impl<type_list<Ts...>, Pred>
+{
+    using type = pick_t<type_list<Ts...>, std::array<bool, sizeof...(Ts)>{ static_cast<bool>(Pred<Ts>::value)... }>;
+};
+
+template <typename List>
+struct unique_impl;
+
+template <typename... Ts>
+struct unique_impl<type_list<Ts...>>
+{
+    // 처음 나온 위치의 요소만 남김
+    template <usize... I>
+    static consteval std::array<bool, sizeof...(Ts)> first_occurrences(std::index_sequence<I...>) noexcept
+    {
+        return { (index_of_impl<type_list<Ts...>, Ts>::value == I)... };
+    }
+
+    using type = pick_t<type_list<Ts...>, first_occurrences(std::index_sequence_for<Ts...>{})>;
+};
+
+// -----------------------------------------------------------------------------
+// 연결: operator+ 오버로드에 대한 fold 식 (재귀 템플릿 없음)
+// -----------------------------------------------------------------------------
+template <typename... Ts, typename... Us>
+type_list<Ts..., Us...> operator+(type_list<Ts...>, type_list<Us...>);
+
+template <typename... Lists>
+struct concat_impl
+{
+    using type = decltype((type_list<>{} + ... + std::declval<Lists>()));
+};
+
+template <typename T>
+struct flatten_list_impl
+{
+    using type = type_list<T>;
+};
+
+template <typename... Ts>
+struct flatten_list_impl<type_list<Ts...>>
+{
+    using type = typename concat_impl<typename flatten_list_impl<Ts>::type...>::type;
+};
+
+template <typename List, template <typename> typename Fn>
+struct transform_impl;
+
+template <typename... Ts, template <typename> typename Fn>
+struct transform_impl<type_list<Ts...>, Fn>
+{
+    using type = type_list<Fn<Ts>...>;
+};
+
+template <typename TupleLike>
+struct to_type_list_impl;
+
+template <template <typename...> typename TupleLike, typename... Ts>
+struct to_type_list_impl<TupleLike<Ts...>>
+{
+    using type = type_list<Ts...>;
+};
+
+template <typename R, typename... Ts>
+struct to_type_list_impl<R(Ts...)>
+{
+    using type = type_list<Ts...>;
+};
+} // namespace internal
+
+/** I번째 타입 */
+template <typename List, usize I>
+using type_at_t = typename internal::type_at_impl<I, List>::type;
+
+/** T가 처음 나오는 인덱스 (없으면 type_npos) */
+template <typename List, typename T>
+constexpr usize index_of_v = internal::index_of_impl<List, T>::value;
+
+/** T가 목록에 있는지 여부 */
+template <typename List, typename T>
+constexpr bool contains_v = index_of_v<List, T> != type_npos;
+
+/** Pred<T>::value가 true인 첫 타입의 인덱스 (없으면 type_npos) */
+template <typename List, template <typename> typename Pred>
+constexpr usize find_if_v = internal::find_if_impl<List, Pred>::value;
+
+/** Pred<T>::value가 true인 타입만 남긴 목록 */
+template <typename List, template <typename> typename Pred>
+using filter_t = typename internal::filter_impl<List, Pred>::type;
+
+/** 중복을 제거한 목록 (처음 나온 순서 유지) */
+template <typename List>
+using unique_t = typename internal::unique_impl<List>::type;
+
+/** 여러 목록을 이어 붙인 목록 */
+template <typename... Lists>
+using concat_t = typename internal::concat_impl<Lists...>::type;
+
+/** 중첩된 type_list를 평탄화한 목록 */
+template <typename List>
+using flatten_t = typename internal::flatten_list_impl<List>::type;
+
+/** 각 타입에 Fn을 적용한 목록 (예: transform_t<list, std::add_pointer_t>) */
+template <typename List, template <typename> typename Fn>
+using transform_t = typename internal::transform_impl<List, Fn>::type;
+
+/** 튜플이나 함수 시그니처의 타입들로 만든 목록 (예: std::tuple<int, float> → type_list<int, float>) */
+template <typename TupleLike>
+using to_type_list_t = typename internal::to_type_list_impl<TupleLike>::type;
+} // namespace sw
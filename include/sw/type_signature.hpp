@@ -186,6 +186,44 @@ consteval std::string_view extract_type_name() noexcept
     return {};
 #endif
 }
+
+/**
+ * 추출한 이름만 담는 널 종료 문자 배열
+ * 시그니처 리터럴을 가리키는 string_view를 그대로 반환하면 바이너리에 get_raw_signature<T>의 전체 시그니처가 남으므로,
+ * 이름을 이 배열로 복사해 필요한 문자만 남깁니다.
+ */
+template <usize N>
+struct static_name
+{
+    std::array<char, N + 1> chars{};
+
+    [[nodiscard]] constexpr std::string_view view() const noexcept { return std::string_view{ chars.data(), N }; }
+};
+
+template <usize N>
+consteval static_name<N> make_static_name(std::string_view name) noexcept
+{
+    static_name<N> result;
+    const char* source = name.data();
+    char* dest = result.chars.data();
+    for (usize i = 0; i < N; ++i)
+    {
+        dest[i] = source[i];
+    }
+    return result;
+}
+
+template <typename T>
+consteval auto make_type_name_storage() noexcept
+{
+    // 시그니처 파싱은 한 번만 하고, 복사는 string_view::operator[] 호출 없이 포인터로 (상수 평가 비용 절감)
+    constexpr std::string_view name = extract_type_name<T>();
+    return make_static_name<name.size()>(name);
+}
+
+/** 타입 T의 원본 이름 저장소 (full_type_name/type_name은 이 배열의 접미사를 가리킴) */
+template <typename T>
+inline constexpr auto raw_type_name_storage = make_type_name_storage<T>();
 } // namespace internal
 
 /**
@@ -195,7 +233,7 @@ consteval std::string_view extract_type_name() noexcept
 template <typename T>
 [[nodiscard]] consteval std::string_view raw_type_name() noexcept
 {
-    constexpr auto ret = internal::extract_type_name<T>();
+    constexpr auto ret = internal::raw_type_name_storage<T>.view();
 
     // IDE 버그 때문에 일단 주석
     // static_assert(!ret.empty(), "Failed to extract type name from type T");
@@ -211,7 +249,7 @@ template <typename T>
 [[nodiscard]] consteval std::string_view full_type_name() noexcept
 {
     using CleanType = internal::unwrap_type_t<T>;
-    constexpr auto raw_name = internal::extract_type_name<CleanType>();
+    constexpr auto raw_name = internal::raw_type_name_storage<CleanType>.view();
 
     // 선행 타입 키워드 ("class", "struct", "enum", "union") 제거
     constexpr std::array<std::string_view, 5> leading_keywords = { "class", "struct", "enum", "union", "typename" };
@@ -43,4 +43,38 @@ struct function_traits<R(C::*)(Args...) volatile> : function_traits<R(Args...)>
 // 람다/함수 객체 지원 (operator() 사용)
 template <typename Fn>
 struct function_traits<Fn, std::void_t<decltype(&Fn::operator())>> : function_traits<decltype(&Fn::operator())> {};
+
+// -------------------------------------------------------------------------
+// Trivially Relocatable: 이동 생성 + 원본 소멸을 memcpy 한 번으로 대체할 수 있는 타입
+// -------------------------------------------------------------------------
+/**
+ * 타입 T가 trivially relocatable인지 나타냅니다.
+ * 기본값은 trivially copyable 타입만 true이며, 자기 자신을 가리키는 포인터가 없는 타입은
+ * SW_TRIVIALLY_RELOCATABLE(Type) 또는 특수화로 직접 지정할 수 있습니다.
+ */
+template <typename T>
+struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+template <typename T>
+struct is_trivially_relocatable<const T> : is_trivially_relocatable<T> {};
+
+template <typename T>
+struct is_trivially_relocatable<volatile T> : std::false_type {};
+
+template <typename T, usize N>
+struct is_trivially_relocatable<T[N]> : is_trivially_relocatable<T> {};
+
+template <typename T>
+constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
 } // namespace sw
+
+/**
+ * 사용자 타입을 trivially relocatable로 지정합니다. (전역 네임스페이스에서 사용)
+ * @code
+ * struct Handle { std::unique_ptr<Resource> ptr; };
+ * SW_TRIVIALLY_RELOCATABLE(Handle);
+ * @endcode
+ */
+#define SW_TRIVIALLY_RELOCATABLE(Type) \
+    template <> \
+    struct sw::is_trivially_relocatable<Type> : std::true_type {}
@@ -0,0 +1,115 @@
+#include "sw/alloc_tracker.hpp"
+#include "sw/memory.hpp"
+
+#if SW_ALLOC_TRACKING && SW_ALLOC_TRACKING_GLOBAL_NEW
+
+#include <cstdlib>
+
+#if SW_PLATFORM_WINDOWS
+    #include <malloc.h>
+#endif
+
+
+namespace
+{
+using sw::usize;
+
+// 해제 시 크기를 알 수 있도록 사용자 영역 바로 앞에 요청 크기를 저장
+constexpr usize size_prefix = alignof(std::max_align_t);
+
+[[nodiscard]] usize& stored_size(void* user) noexcept
+{
+    return *(static_cast<usize*>(user) - 1);
+}
+
+[[nodiscard]] void* tracked_malloc(usize size, usize alignment) noexcept
+{
+    // 정렬이 prefix보다 크면 prefix 자리를 정렬 단위로 늘림
+    const usize offset = std::max(size_prefix, alignment);
+
+    void* raw;
+    if (alignment <= alignof(std::max_align_t))
+    {
+        raw = std::malloc(size + offset);
+    }
+    else
+    {
+#if SW_PLATFORM_WINDOWS
+        raw = _aligned_malloc(size + offset, alignment);
+#else
+        raw = std::aligned_alloc(alignment, sw::aligned_size(size + offset, alignment));
+#endif
+    }
+    if (!raw)
+    {
+        return nullptr;
+    }
+
+    void* user = static_cast<std::byte*>(raw) + offset;
+    stored_size(user) = size;
+    sw::alloc_tracker::record_allocation(sw::internal::alloc_global_new, size);
+    return user;
+}
+
+void tracked_free(void* user, usize alignment) noexcept
+{
+    if (!user)
+    {
+        return;
+    }
+
+    sw::alloc_tracker::record_deallocation(sw::internal::alloc_global_new, stored_size(user));
+
+    void* raw = static_cast<std::byte*>(user) - std::max(size_prefix, alignment);
+    if (alignment <= alignof(std::max_align_t))
+    {
+        std::free(raw);
+    }
+    else
+    {
+#if SW_PLATFORM_WINDOWS
+        _aligned_free(raw);
+#else
+        std::free(raw);
+#endif
+    }
+}
+
+[[nodiscard]] void* tracked_new(usize size, usize alignment)
+{
+    if (void* user = tracked_malloc(size, alignment))
+    {
+        return user;
+    }
+    throw std::bad_alloc();
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+// 전역 operator new/delete 교체
+// -----------------------------------------------------------------------------
+void* operator new(std::size_t size) { return tracked_new(size, 0); }
+void* operator new[](std::size_t size) { return tracked_new(size, 0); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return tracked_malloc(size, 0); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return tracked_malloc(size, 0); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) { return tracked_new(size, static_cast<usize>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return tracked_new(size, static_cast<usize>(alignment)); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return tracked_malloc(size, static_cast<usize>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return tracked_malloc(size, static_cast<usize>(alignment)); }
+
+void operator delete(void* ptr) noexcept { tracked_free(ptr, 0); }
+void operator delete[](void* ptr) noexcept { tracked_free(ptr, 0); }
+void operator delete(void* ptr, std::size_t) noexcept { tracked_free(ptr, 0); }
+void operator delete[](void* ptr, std::size_t) noexcept { tracked_free(ptr, 0); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { tracked_free(ptr, 0); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { tracked_free(ptr, 0); }
+
+void operator delete(void* ptr, std::align_val_t alignment) noexcept { tracked_free(ptr, static_cast<usize>(alignment)); }
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept { tracked_free(ptr, static_cast<usize>(alignment)); }
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept { tracked_free(ptr, static_cast<usize>(alignment)); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t alignment) noexcept { tracked_free(ptr, static_cast<usize>(alignment)); }
+void operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept { tracked_free(ptr, static_cast<usize>(alignment)); }
+void operator delete[](void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept { tracked_free(ptr, static_cast<usize>(alignment)); }
+
+#endif
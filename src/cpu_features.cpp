@@ -0,0 +1,169 @@
+#include "sw/cpu_features.hpp"
+
+#if SW_ARCH_X64 || SW_ARCH_X86
+    #if SW_COMPILER_MSVC
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#elif SW_ARCH_ARM64
+    #if SW_PLATFORM_WINDOWS
+        #ifndef WIN32_LEAN_AND_MEAN
+            #define WIN32_LEAN_AND_MEAN
+        #endif
+        #ifndef NOMINMAX
+            #define NOMINMAX
+        #endif
+        #include <windows.h>
+    #elif SW_PLATFORM_LINUX
+        #include <sys/auxv.h>
+    #endif
+#endif
+
+
+namespace sw::internal
+{
+#if SW_ARCH_X64 || SW_ARCH_X86
+
+namespace
+{
+struct cpuid_registers
+{
+    u32 eax = 0;
+    u32 ebx = 0;
+    u32 ecx = 0;
+    u32 edx = 0;
+};
+
+[[nodiscard]] cpuid_registers cpuid(u32 leaf, u32 subleaf) noexcept
+{
+    cpuid_registers result;
+#if SW_COMPILER_MSVC
+    int registers[4];
+    __cpuidex(registers, static_cast<int>(leaf), static_cast<int>(subleaf));
+    result = { static_cast<u32>(registers[0]), static_cast<u32>(registers[1]),
+               static_cast<u32>(registers[2]), static_cast<u32>(registers[3]) };
+#else
+    __cpuid_count(leaf, subleaf, result.eax, result.ebx, result.ecx, result.edx);
+#endif
+    return result;
+}
+
+// XCR0: OS가 문맥 전환 시 저장하는 레지스터 상태 (OSXSAVE가 켜진 경우에만 호출)
+[[nodiscard]] u64 read_xcr0() noexcept
+{
+#if SW_COMPILER_MSVC
+    return _xgetbv(0);
+#else
+    u32 low, high;
+    __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+    return (u64{ high } << 32) | low;
+#endif
+}
+
+[[nodiscard]] constexpr bool bit(u32 value, u32 index) noexcept
+{
+    return (value >> index) & 1;
+}
+} // namespace
+
+u64 detect_cpu_features() noexcept
+{
+    cpu_feature features = cpu_feature::none;
+    const auto add = [&](bool supported, cpu_feature feature)
+    {
+        if (supported)
+        {
+            features = features | feature;
+        }
+    };
+
+    const u32 max_leaf = cpuid(0, 0).eax;
+    if (max_leaf < 1)
+    {
+        return 0;
+    }
+
+    const cpuid_registers leaf1 = cpuid(1, 0);
+    add(bit(leaf1.edx, 26), cpu_feature::sse2);
+    add(bit(leaf1.ecx, 0), cpu_feature::sse3);
+    add(bit(leaf1.ecx, 9), cpu_feature::ssse3);
+    add(bit(leaf1.ecx, 19), cpu_feature::sse4_1);
+    add(bit(leaf1.ecx, 20), cpu_feature::sse4_2);
+    add(bit(leaf1.ecx, 23), cpu_feature::popcnt);
+    add(bit(leaf1.ecx, 25), cpu_feature::aes);
+
+    // CPU가 지원해도 OS가 YMM/ZMM 상태를 저장하지 않으면 사용할 수 없음
+    const u64 xcr0 = bit(leaf1.ecx, 27) ? read_xcr0() : 0;
+    const bool os_avx = (xcr0 & 0x06) == 0x06;    // XMM | YMM
+    const bool os_avx512 = (xcr0 & 0xE6) == 0xE6; // XMM | YMM | opmask | ZMM_Hi256 | Hi16_ZMM
+
+    add(os_avx && bit(leaf1.ecx, 28), cpu_feature::avx);
+    add(os_avx && bit(leaf1.ecx, 12), cpu_feature::fma);
+    add(os_avx && bit(leaf1.ecx, 29), cpu_feature::f16c);
+
+    if (max_leaf >= 7)
+    {
+        const cpuid_registers leaf7 = cpuid(7, 0);
+        add(bit(leaf7.ebx, 3), cpu_feature::bmi1);
+        add(bit(leaf7.ebx, 8), cpu_feature::bmi2);
+        add(bit(leaf7.ebx, 29), cpu_feature::sha);
+        add(os_avx && bit(leaf7.ebx, 5), cpu_feature::avx2);
+        add(os_avx512 && bit(leaf7.ebx, 16), cpu_feature::avx512f);
+        add(os_avx512 && bit(leaf7.ebx, 17), cpu_feature::avx512dq);
+        add(os_avx512 && bit(leaf7.ebx, 30), cpu_feature::avx512bw);
+        add(os_avx512 && bit(leaf7.ebx, 31), cpu_feature::avx512vl);
+    }
+
+    return static_cast<u64>(features);
+}
+
+#elif SW_ARCH_ARM64
+
+u64 detect_cpu_features() noexcept
+{
+    // AArch64에서 Advanced SIMD는 필수
+    cpu_feature features = cpu_feature::neon;
+    const auto add = [&](bool supported, cpu_feature feature)
+    {
+        if (supported)
+        {
+            features = features | feature;
+        }
+    };
+
+#if SW_PLATFORM_LINUX
+    // <asm/hwcap.h>의 값 (오래된 커널 헤더에 없는 항목이 있어 직접 정의)
+    constexpr unsigned long hwcap_aes = 1ul << 3;
+    constexpr unsigned long hwcap_sha2 = 1ul << 6;
+    constexpr unsigned long hwcap_crc32 = 1ul << 7;
+    constexpr unsigned long hwcap_sve = 1ul << 22;
+    constexpr unsigned long hwcap2_sve2 = 1ul << 1;
+
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+    const unsigned long hwcap2 = getauxval(AT_HWCAP2);
+    add(hwcap & hwcap_aes, cpu_feature::arm_aes);
+    add(hwcap & hwcap_sha2, cpu_feature::arm_sha2);
+    add(hwcap & hwcap_crc32, cpu_feature::crc32);
+    add(hwcap & hwcap_sve, cpu_feature::sve);
+    add(hwcap2 & hwcap2_sve2, cpu_feature::sve2);
+#elif SW_PLATFORM_WINDOWS
+    add(IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE), cpu_feature::arm_aes | cpu_feature::arm_sha2);
+    add(IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE), cpu_feature::crc32);
+#elif SW_PLATFORM_MACOS
+    // Apple Silicon은 모두 ARMv8.4 이상이므로 CRC32/AES/SHA2를 항상 지원 (SVE는 없음)
+    add(true, cpu_feature::crc32 | cpu_feature::arm_aes | cpu_feature::arm_sha2);
+#endif
+
+    return static_cast<u64>(features);
+}
+
+#else
+
+u64 detect_cpu_features() noexcept
+{
+    return 0;
+}
+
+#endif
+} // namespace sw::internal
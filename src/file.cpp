@@ -0,0 +1,259 @@
+#include "sw/file.hpp"
+
+#if SW_PLATFORM_WINDOWS
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+
+namespace sw::internal
+{
+#if SW_PLATFORM_WINDOWS
+
+namespace
+{
+HANDLE to_handle(isize file) noexcept
+{
+    return reinterpret_cast<HANDLE>(file);
+}
+} // namespace
+
+std::error_code last_file_error() noexcept
+{
+    return { static_cast<int>(GetLastError()), std::system_category() };
+}
+
+isize file_open(const std::filesystem::path& path, file_access access, bool create) noexcept
+{
+    const DWORD desired = access == file_access::read_write ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ;
+    HANDLE file = CreateFileW(path.c_str(), desired, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+        create ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return invalid_file;
+    }
+    return reinterpret_cast<isize>(file);
+}
+
+void file_close(isize file) noexcept
+{
+    CloseHandle(to_handle(file));
+}
+
+bool file_size(isize file, u64& size) noexcept
+{
+    LARGE_INTEGER value;
+    if (!GetFileSizeEx(to_handle(file), &value))
+    {
+        return false;
+    }
+    size = static_cast<u64>(value.QuadPart);
+    return true;
+}
+
+bool file_resize(isize file, u64 size) noexcept
+{
+    FILE_END_OF_FILE_INFO info;
+    info.EndOfFile.QuadPart = static_cast<LONGLONG>(size);
+    return SetFileInformationByHandle(to_handle(file), FileEndOfFileInfo, &info, sizeof(info)) != 0;
+}
+
+isize file_read_at(isize file, void* buffer, usize size, u64 offset) noexcept
+{
+    // OVERLAPPED에 위치를 지정하면 파일 포인터를 공유하지 않는 pread처럼 동작함
+    auto* out = static_cast<std::byte*>(buffer);
+    usize total = 0;
+    while (total < size)
+    {
+        const u64 position = offset + total;
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(position);
+        overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+
+        const DWORD request = static_cast<DWORD>(std::min<usize>(size - total, 1u << 30));
+        DWORD read = 0;
+        if (!ReadFile(to_handle(file), out + total, request, &read, &overlapped))
+        {
+            if (GetLastError() == ERROR_HANDLE_EOF)
+            {
+                break;
+            }
+            return -1;
+        }
+        if (read == 0)
+        {
+            break;
+        }
+        total += read;
+    }
+    return static_cast<isize>(total);
+}
+
+void file_advise_sequential(isize /*file*/) noexcept
+{
+    // Windows는 열 때 FILE_FLAG_SEQUENTIAL_SCAN으로만 지정할 수 있고, 캐시 관리자의 기본 미리 읽기로 충분함
+}
+
+file_mapping file_map(isize file, usize size, file_access access) noexcept
+{
+    const bool writable = access == file_access::read_write;
+    HANDLE mapping = CreateFileMappingW(to_handle(file), nullptr, writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        return {};
+    }
+
+    void* address = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+    if (!address)
+    {
+        const DWORD error = GetLastError();
+        CloseHandle(mapping);
+        SetLastError(error);
+        return {};
+    }
+    return file_mapping{ address, size, reinterpret_cast<isize>(mapping) };
+}
+
+void file_unmap(const file_mapping& mapping) noexcept
+{
+    UnmapViewOfFile(mapping.address);
+    CloseHandle(to_handle(mapping.native));
+}
+
+void file_advise(void* address, usize size, access_pattern pattern) noexcept
+{
+    // Windows에는 madvise에 해당하는 힌트가 없으므로, 곧 읽을 범위만 미리 올려 둠
+    if (pattern == access_pattern::sequential || pattern == access_pattern::will_need)
+    {
+        WIN32_MEMORY_RANGE_ENTRY range{ address, size };
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+}
+
+bool file_flush(void* address, usize size) noexcept
+{
+    return FlushViewOfFile(address, size) != 0;
+}
+
+#else
+
+std::error_code last_file_error() noexcept
+{
+    return { errno, std::system_category() };
+}
+
+isize file_open(const std::filesystem::path& path, file_access access, bool create) noexcept
+{
+    int flags = (access == file_access::read_write ? O_RDWR : O_RDONLY) | O_CLOEXEC;
+    if (create)
+    {
+        flags |= O_CREAT;
+    }
+
+    int fd;
+    do
+    {
+        fd = open(path.c_str(), flags, 0644);
+    } while (fd < 0 && errno == EINTR);
+    return fd < 0 ? invalid_file : fd;
+}
+
+void file_close(isize file) noexcept
+{
+    close(static_cast<int>(file));
+}
+
+bool file_size(isize file, u64& size) noexcept
+{
+    struct stat info;
+    if (fstat(static_cast<int>(file), &info) != 0)
+    {
+        return false;
+    }
+    size = static_cast<u64>(info.st_size);
+    return true;
+}
+
+bool file_resize(isize file, u64 size) noexcept
+{
+    return ftruncate(static_cast<int>(file), static_cast<off_t>(size)) == 0;
+}
+
+isize file_read_at(isize file, void* buffer, usize size, u64 offset) noexcept
+{
+    auto* out = static_cast<std::byte*>(buffer);
+    usize total = 0;
+    while (total < size)
+    {
+        const ssize_t read = pread(static_cast<int>(file), out + total, size - total, static_cast<off_t>(offset + total));
+        if (read < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+        if (read == 0)
+        {
+            break;
+        }
+        total += static_cast<usize>(read);
+    }
+    return static_cast<isize>(total);
+}
+
+void file_advise_sequential([[maybe_unused]] isize file) noexcept
+{
+#if defined(POSIX_FADV_SEQUENTIAL)
+    posix_fadvise(static_cast<int>(file), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+}
+
+file_mapping file_map(isize file, usize size, file_access access) noexcept
+{
+    const int protection = access == file_access::read_write ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* address = mmap(nullptr, size, protection, MAP_SHARED, static_cast<int>(file), 0);
+    if (address == MAP_FAILED)
+    {
+        return {};
+    }
+    return file_mapping{ address, size, invalid_file };
+}
+
+void file_unmap(const file_mapping& mapping) noexcept
+{
+    munmap(mapping.address, mapping.size);
+}
+
+void file_advise(void* address, usize size, access_pattern pattern) noexcept
+{
+    int advice = MADV_NORMAL;
+    switch (pattern)
+    {
+    case access_pattern::normal: advice = MADV_NORMAL; break;
+    case access_pattern::sequential: advice = MADV_SEQUENTIAL; break;
+    case access_pattern::random: advice = MADV_RANDOM; break;
+    case access_pattern::will_need: advice = MADV_WILLNEED; break;
+    }
+    madvise(address, size, advice);
+}
+
+bool file_flush(void* address, usize size) noexcept
+{
+    return msync(address, size, MS_SYNC) == 0;
+}
+
+#endif
+} // namespace sw::internal
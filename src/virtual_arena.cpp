@@ -0,0 +1,156 @@
+#include "sw/virtual_arena.hpp"
+
+#if SW_PLATFORM_WINDOWS
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+
+namespace sw::internal
+{
+#if SW_PLATFORM_WINDOWS
+
+usize vm_page_size() noexcept
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+}
+
+vm_reservation vm_reserve(usize size, huge_page_mode /*mode*/) noexcept
+{
+    // Windows의 large page는 예약과 동시에 커밋해야 하고 SeLockMemoryPrivilege가 필요하므로
+    // 필요할 때 커밋하는 방식과 맞지 않아 일반 페이지로 예약함
+    void* base = VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+    if (!base)
+    {
+        return {};
+    }
+    return vm_reservation{ base, size, false };
+}
+
+bool vm_commit(void* address, usize size, huge_page_mode /*mode*/) noexcept
+{
+    return VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+}
+
+void vm_decommit(void* address, usize size) noexcept
+{
+    VirtualFree(address, size, MEM_DECOMMIT);
+}
+
+void vm_release(const vm_reservation& reservation) noexcept
+{
+    VirtualFree(reservation.base, 0, MEM_RELEASE);
+}
+
+#else
+
+namespace
+{
+int reserve_flags() noexcept
+{
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+    return flags;
+}
+
+/** huge page 경계에 정렬된 주소 범위를 예약합니다. (THP가 2MiB 단위로 매핑할 수 있도록) */
+void* reserve_aligned(usize size, usize alignment) noexcept
+{
+    const usize padded = size + alignment;
+    void* raw = mmap(nullptr, padded, PROT_NONE, reserve_flags(), -1, 0);
+    if (raw == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    const auto address = reinterpret_cast<usize>(raw);
+    const usize aligned = aligned_size(address, alignment);
+    const usize head = aligned - address;
+    const usize tail = padded - head - size;
+    if (head > 0)
+    {
+        munmap(raw, head);
+    }
+    if (tail > 0)
+    {
+        munmap(reinterpret_cast<void*>(aligned + size), tail);
+    }
+    return reinterpret_cast<void*>(aligned);
+}
+} // namespace
+
+usize vm_page_size() noexcept
+{
+    return static_cast<usize>(sysconf(_SC_PAGESIZE));
+}
+
+vm_reservation vm_reserve(usize size, huge_page_mode mode) noexcept
+{
+#if defined(MAP_HUGETLB)
+    if (mode == huge_page_mode::explicit_)
+    {
+        // MAP_NORESERVE 없이 매핑해야 huge page 풀이 부족할 때 접근 시 SIGBUS 대신 mmap이 실패함
+        void* base = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (base != MAP_FAILED)
+        {
+            return vm_reservation{ base, size, true };
+        }
+        // huge page 풀이 없으면 THP로 대체
+    }
+#endif
+
+    void* base = (mode == huge_page_mode::none)
+        ? mmap(nullptr, size, PROT_NONE, reserve_flags(), -1, 0)
+        : reserve_aligned(size, huge_page_size);
+    if (!base || base == MAP_FAILED)
+    {
+        return {};
+    }
+    return vm_reservation{ base, size, false };
+}
+
+bool vm_commit(void* address, usize size, huge_page_mode mode) noexcept
+{
+    if (mprotect(address, size, PROT_READ | PROT_WRITE) != 0)
+    {
+        return false;
+    }
+
+#if defined(MADV_HUGEPAGE)
+    if (mode != huge_page_mode::none)
+    {
+        // 힌트일 뿐이므로 실패해도 무시
+        madvise(address, size, MADV_HUGEPAGE);
+    }
+#else
+    (void)mode;
+#endif
+    return true;
+}
+
+void vm_decommit(void* address, usize size) noexcept
+{
+    // 물리 페이지를 돌려준 뒤 다시 접근 불가로 되돌림
+    madvise(address, size, MADV_DONTNEED);
+    mprotect(address, size, PROT_NONE);
+}
+
+void vm_release(const vm_reservation& reservation) noexcept
+{
+    munmap(reservation.base, reservation.size);
+}
+
+#endif
+} // namespace sw::internal
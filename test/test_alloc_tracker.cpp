@@ -0,0 +1,128 @@
+#include <array>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sw/alloc_tracker.hpp"
+#include "sw/function.hpp"
+#include "sw/memory.hpp"
+#include "sw/pool.hpp"
+#include "utils.hpp"
+
+struct tracked_payload
+{
+    std::array<char, 256> data{};
+};
+
+void run_tests()
+{
+    static_assert(sw::alloc_tracker::enabled);
+
+    // 1. 이름 태그 수동 기록, 히스토그램
+    {
+        const sw::u32 tag = sw::alloc_tracker::tag("test::manual");
+        ASSERT_EQ(sw::alloc_tracker::tag("test::manual"), tag);
+
+        sw::alloc_tracker::record_allocation(tag, 100);
+        sw::alloc_tracker::record_allocation(tag, 5000);
+        sw::alloc_tracker::record_deallocation(tag, 100);
+
+        const auto snapshot = sw::alloc_tracker::snapshot();
+        const auto* stats = snapshot.find("test::manual");
+        ASSERT_TRUE(stats != nullptr);
+        ASSERT_EQ(stats->allocations, 2);
+        ASSERT_EQ(stats->deallocations, 1);
+        ASSERT_EQ(stats->live_bytes(), 5000);
+        ASSERT_EQ(stats->live_count(), 1);
+        ASSERT_EQ(stats->size_histogram[6], 1);  // 100: [64, 128)
+        ASSERT_EQ(stats->size_histogram[12], 1); // 5000: [4096, 8192)
+        ASSERT_TRUE(snapshot.peak_bytes >= static_cast<sw::u64>(snapshot.live_bytes));
+
+        sw::alloc_tracker::record_deallocation(tag, 5000);
+    }
+
+    // 2. sw::function 힙 저장은 호출 객체 타입으로 기록
+    {
+        const auto before = sw::alloc_tracker::snapshot();
+        {
+            tracked_payload payload;
+            sw::function<int()> fn = [payload] { return static_cast<int>(payload.data.size()); };
+            ASSERT_EQ(fn(), 256);
+
+            sw::function<int()> copy = fn;
+            ASSERT_EQ(copy(), 256);
+        }
+        const auto after = sw::alloc_tracker::snapshot();
+        ASSERT_EQ(after.allocations - before.allocations, 2);
+
+        bool found = false;
+        for (const auto& stats : after.tags)
+        {
+            if (stats.name.find("run_tests") != std::string_view::npos && stats.allocations == 2)
+            {
+                found = true;
+                ASSERT_EQ(stats.live_count(), 0);
+                ASSERT_TRUE(stats.allocated_bytes >= 2 * sizeof(tracked_payload));
+            }
+        }
+        ASSERT_TRUE(found);
+        ASSERT_TRUE(sw::allocation_rate(before, after) > 0.0);
+    }
+
+    // 3. arena 블록, 풀 청크
+    {
+        {
+            sw::arena arena{ 4096 };
+            (void)arena.allocate(100);
+            (void)arena.allocate(10000);
+
+            const auto snapshot = sw::alloc_tracker::snapshot();
+            const auto* stats = snapshot.find(sw::full_type_name<sw::arena>());
+            ASSERT_TRUE(stats != nullptr);
+            ASSERT_EQ(stats->live_count(), 2);
+        }
+        {
+            sw::object_pool<tracked_payload> pool;
+            auto* object = pool.create();
+            pool.destroy(object);
+            pool.flush_thread_cache();
+
+            const auto snapshot = sw::alloc_tracker::snapshot();
+            const auto* stats = snapshot.find(sw::full_type_name<sw::internal::pool_depot>());
+            ASSERT_TRUE(stats != nullptr);
+            ASSERT_EQ(stats->live_count(), 1);
+        }
+
+        const auto snapshot = sw::alloc_tracker::snapshot();
+        ASSERT_EQ(snapshot.find(sw::full_type_name<sw::arena>())->live_bytes(), 0);
+        ASSERT_EQ(snapshot.find(sw::full_type_name<sw::internal::pool_depot>())->live_bytes(), 0);
+    }
+
+    // 4. 여러 스레드의 카운터 합산 (종료한 스레드의 값도 유지)
+    {
+        const sw::u32 tag = sw::alloc_tracker::tag("test::threads");
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([tag]
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    sw::alloc_tracker::record_allocation(tag, 64);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        const auto snapshot = sw::alloc_tracker::snapshot();
+        const auto* stats = snapshot.find("test::threads");
+        ASSERT_EQ(stats->allocations, 4000);
+        ASSERT_EQ(stats->live_bytes(), 4000 * 64);
+        ASSERT_TRUE(snapshot.peak_bytes >= 4000 * 64);
+    }
+}
+
+TEST_MAIN
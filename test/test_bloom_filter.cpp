@@ -0,0 +1,164 @@
+#include <string>
+#include <vector>
+
+#include "sw/bloom_filter.hpp"
+#include "utils.hpp"
+
+void run_tests()
+{
+    // 1. 크기 계산: 1% 목표 → 해시 7개, 항목당 약 9.6비트
+    {
+        sw::bloom_filter filter{ 100000, 0.01 };
+        ASSERT_EQ(filter.hash_count(), 7);
+        ASSERT_EQ(filter.block_count(), (958506 + 511) / 512);
+        ASSERT_EQ(filter.size_in_bytes(), filter.block_count() * 64);
+        ASSERT_EQ(filter.fill_ratio(), 0.0);
+    }
+
+    // 2. 넣은 키는 항상 있음, 없는 키의 거짓 양성률은 목표 근처
+    {
+        constexpr sw::usize count = 100000;
+        sw::bloom_filter filter{ count, 0.01 };
+        for (sw::u64 i = 0; i < count; ++i)
+        {
+            filter.insert(i);
+        }
+        for (sw::u64 i = 0; i < count; ++i)
+        {
+            ASSERT_TRUE(filter.contains(i));
+        }
+
+        sw::usize false_positives = 0;
+        for (sw::u64 i = count; i < count * 11; ++i)
+        {
+            false_positives += filter.contains(i);
+        }
+        const double rate = static_cast<double>(false_positives) / static_cast<double>(count * 10);
+        ASSERT_TRUE(rate > 0.002);
+        ASSERT_TRUE(rate < 0.02);
+        ASSERT_TRUE(filter.fill_ratio() > 0.3 && filter.fill_ratio() < 0.6);
+    }
+
+    // 3. 문자열 키 (fnv1a)
+    {
+        sw::bloom_filter filter{ 1000, 0.001 };
+        filter.insert(std::string{ "alpha" });
+        filter.insert("beta");
+        ASSERT_TRUE(filter.contains("alpha"));
+        ASSERT_TRUE(filter.contains(std::string_view{ "beta" }));
+        ASSERT_TRUE(!filter.contains("gamma"));
+    }
+
+    // 4. 묶음 삽입/조회는 하나씩 한 것과 같음
+    {
+        std::vector<sw::u64> keys;
+        for (sw::u64 i = 0; i < 1000; ++i)
+        {
+            keys.push_back(i * 7919);
+        }
+
+        sw::bloom_filter bulk{ 1000, 0.01 };
+        sw::bloom_filter single{ 1000, 0.01 };
+        bulk.insert_all<sw::u64>(keys);
+        for (const sw::u64 key : keys)
+        {
+            single.insert(key);
+        }
+        ASSERT_TRUE(bulk.to_bytes() == single.to_bytes());
+
+        std::vector<sw::u64> queries;
+        for (sw::u64 i = 0; i < 3000; ++i)
+        {
+            queries.push_back(i * 7919);
+        }
+        std::vector<char> storage(queries.size());
+        std::span<bool> results{ reinterpret_cast<bool*>(storage.data()), storage.size() };
+        const sw::usize positives = bulk.contains_all<sw::u64>(queries, results);
+
+        sw::usize expected = 0;
+        for (sw::usize i = 0; i < queries.size(); ++i)
+        {
+            ASSERT_EQ(results[i], single.contains(queries[i]));
+            expected += results[i];
+        }
+        ASSERT_EQ(positives, expected);
+        ASSERT_TRUE(positives >= 1000);
+    }
+
+    // 5. 직렬화 왕복과 잘못된 입력
+    {
+        sw::bloom_filter filter{ 5000, 0.05 };
+        for (int i = 0; i < 5000; ++i)
+        {
+            filter.insert(i);
+        }
+
+        const auto bytes = filter.to_bytes();
+        ASSERT_EQ(bytes.size(), filter.serialized_size());
+        const auto loaded = sw::bloom_filter::from_bytes(bytes);
+        ASSERT_EQ(loaded.block_count(), filter.block_count());
+        ASSERT_EQ(loaded.hash_count(), filter.hash_count());
+        ASSERT_TRUE(loaded.to_bytes() == bytes);
+        for (int i = 0; i < 5000; ++i)
+        {
+            ASSERT_TRUE(loaded.contains(i));
+        }
+
+        auto expect_invalid = [](std::span<const std::byte> input)
+        {
+            try
+            {
+                (void)sw::bloom_filter::from_bytes(input);
+            }
+            catch (const std::invalid_argument&)
+            {
+                return true;
+            }
+            return false;
+        };
+        ASSERT_TRUE(expect_invalid(std::span{ bytes }.first(10)));
+        ASSERT_TRUE(expect_invalid(std::span{ bytes }.first(bytes.size() - 1)));
+        auto corrupted = bytes;
+        corrupted[0] = std::byte{ 'X' };
+        ASSERT_TRUE(expect_invalid(corrupted));
+
+        std::vector<std::byte> small(10);
+        bool thrown = false;
+        try
+        {
+            filter.serialize_to(small);
+        }
+        catch (const std::length_error&)
+        {
+            thrown = true;
+        }
+        ASSERT_TRUE(thrown);
+    }
+
+    // 6. 합치기와 비우기
+    {
+        sw::bloom_filter a{ 64, 4, std::in_place };
+        sw::bloom_filter b{ 64, 4, std::in_place };
+        a.insert(1);
+        b.insert(2);
+        a.merge(b);
+        ASSERT_TRUE(a.contains(1) && a.contains(2));
+
+        bool thrown = false;
+        try
+        {
+            a.merge(sw::bloom_filter{ 32, 4, std::in_place });
+        }
+        catch (const std::invalid_argument&)
+        {
+            thrown = true;
+        }
+        ASSERT_TRUE(thrown);
+
+        a.clear();
+        ASSERT_TRUE(!a.contains(1));
+        ASSERT_EQ(a.fill_ratio(), 0.0);
+    }
+}
+
+TEST_MAIN
@@ -0,0 +1,125 @@
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "sw/cpu_features.hpp"
+#include "utils.hpp"
+
+namespace
+{
+using sw::u8;
+using sw::u64;
+using sw::usize;
+
+u64 sum_scalar(const u8* data, usize size)
+{
+    u64 sum = 0;
+    for (usize i = 0; i < size; ++i)
+    {
+        sum += data[i];
+    }
+    return sum;
+}
+
+#if SW_ARCH_X64 || SW_ARCH_X86
+// 같은 코드를 AVX2로 컴파일해 자동 벡터화
+SW_TARGET("avx2") u64 sum_avx2(const u8* data, usize size)
+{
+    u64 sum = 0;
+    for (usize i = 0; i < size; ++i)
+    {
+        sum += data[i];
+    }
+    return sum;
+}
+#else
+u64 sum_avx2(const u8* data, usize size)
+{
+    return sum_scalar(data, size);
+}
+#endif
+
+u64 sum_never(const u8*, usize)
+{
+    return 0;
+}
+} // namespace
+
+void run_tests()
+{
+    const auto& cpu = sw::cpu_features::current();
+
+    // 1. 검사는 한 번만, 아키텍처별 기본 기능
+    {
+        ASSERT_TRUE(&cpu == &sw::cpu_features::current());
+        ASSERT_TRUE(cpu.has(sw::cpu_feature::none));
+#if SW_ARCH_X64
+        ASSERT_TRUE(cpu.has(sw::cpu_feature::sse2)); // x64에서는 필수
+#elif SW_ARCH_ARM64
+        ASSERT_TRUE(cpu.has(sw::cpu_feature::neon));
+#endif
+        // AVX2는 OS 지원을 확인한 AVX 위에서만 보고됨
+        if (cpu.has(sw::cpu_feature::avx2))
+        {
+            ASSERT_TRUE(cpu.has(sw::cpu_feature::avx));
+        }
+        if (cpu.has(sw::cpu_feature::avx512vl))
+        {
+            ASSERT_TRUE(cpu.has(sw::cpu_feature::avx));
+        }
+    }
+
+    // 2. 기능 조합 연산, 이름
+    {
+        const sw::cpu_features features{ sw::cpu_feature::avx2 | sw::cpu_feature::bmi2 };
+        ASSERT_TRUE(features.has(sw::cpu_feature::avx2));
+        ASSERT_TRUE(features.has(sw::cpu_feature::avx2 | sw::cpu_feature::bmi2));
+        ASSERT_TRUE(!features.has(sw::cpu_feature::avx2 | sw::cpu_feature::avx512f));
+        ASSERT_TRUE(!features.without(sw::cpu_feature::bmi2).has(sw::cpu_feature::bmi2));
+        ASSERT_EQ(features.to_string(), std::string("avx2 bmi2"));
+        ASSERT_TRUE(sw::cpu_feature_name(sw::cpu_feature::sse4_2) == "sse4.2");
+        ASSERT_TRUE(sw::cpu_features{ sw::cpu_feature::x86_64_v3 }.has(sw::cpu_feature::x86_64_v2));
+    }
+
+    // 3. 우선순위 순서로 지원되는 첫 구현을 선택
+    {
+        using dispatch_type = sw::cpu_dispatch<u64(const u8*, usize)>;
+
+        const dispatch_type on_avx2{
+            { { sum_avx2, sw::cpu_feature::avx2 }, { sum_scalar } },
+            sw::cpu_features{ sw::cpu_feature::avx2 },
+        };
+        const dispatch_type on_baseline{
+            { { sum_never, sw::cpu_feature::avx512f }, { sum_avx2, sw::cpu_feature::avx2 }, { sum_scalar } },
+            sw::cpu_features{ sw::cpu_feature::sse2 },
+        };
+        ASSERT_TRUE(on_avx2.get() == &sum_avx2);
+        ASSERT_TRUE(on_baseline.get() == &sum_scalar);
+
+        // 실행 중인 CPU 기준으로 선택한 구현도 같은 결과
+        const dispatch_type sum{ { sum_avx2, sw::cpu_feature::avx2 }, { sum_scalar } };
+        std::vector<u8> bytes(1000);
+        std::iota(bytes.begin(), bytes.end(), u8{ 0 });
+        ASSERT_EQ(sum(bytes.data(), bytes.size()), sum_scalar(bytes.data(), bytes.size()));
+        ASSERT_TRUE(sum.get() == (cpu.has(sw::cpu_feature::avx2) ? &sum_avx2 : &sum_scalar));
+    }
+
+    // 4. 지원되는 후보가 없으면 예외
+    {
+        bool thrown = false;
+        try
+        {
+            const sw::cpu_dispatch<u64(const u8*, usize)> invalid{
+                { { sum_avx2, sw::cpu_feature::avx2 } },
+                sw::cpu_features{},
+            };
+        }
+        catch (const std::invalid_argument&)
+        {
+            thrown = true;
+        }
+        ASSERT_TRUE(thrown);
+    }
+}
+
+TEST_MAIN
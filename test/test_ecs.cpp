@@ -0,0 +1,241 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "sw/ecs.hpp"
+#include "utils.hpp"
+
+struct Position
+{
+    float x, y;
+};
+
+struct Velocity
+{
+    float x, y;
+};
+
+struct Name
+{
+    std::string value;
+};
+
+struct Throwing
+{
+    explicit Throwing(bool fail)
+    {
+        if (fail)
+        {
+            throw std::runtime_error("Throwing");
+        }
+    }
+};
+
+void run_tests()
+{
+    // 1. 엔티티 생성/파괴와 세대
+    {
+        sw::registry reg;
+        const sw::entity a = reg.create();
+        const sw::entity b = reg.create();
+        ASSERT_TRUE(reg.alive(a));
+        ASSERT_TRUE(reg.alive(b));
+        ASSERT_EQ(reg.size(), 2);
+
+        ASSERT_TRUE(reg.destroy(a));
+        ASSERT_TRUE(!reg.alive(a));
+        ASSERT_TRUE(!reg.destroy(a));
+
+        // 인덱스는 재사용되지만 세대가 다름
+        const sw::entity c = reg.create();
+        ASSERT_EQ(c.index, a.index);
+        ASSERT_TRUE(c != a);
+        ASSERT_TRUE(reg.alive(c));
+        ASSERT_TRUE(!reg.alive(a));
+    }
+
+    // 2. 컴포넌트 추가/삭제/조회
+    {
+        sw::registry reg;
+        const sw::entity e = reg.create();
+        reg.emplace<Position>(e, 1.0f, 2.0f);
+        reg.emplace<Name>(e, "player");
+
+        ASSERT_TRUE((reg.has<Position, Name>(e)));
+        ASSERT_TRUE(!reg.has<Velocity>(e));
+        ASSERT_EQ(reg.get<Position>(e).y, 2.0f);
+        ASSERT_EQ(reg.get<Name>(e).value, std::string("player"));
+        ASSERT_TRUE(reg.try_get<Velocity>(e) == nullptr);
+
+        ASSERT_TRUE(reg.remove<Position>(e));
+        ASSERT_TRUE(!reg.has<Position>(e));
+        ASSERT_TRUE(!reg.remove<Position>(e));
+
+        reg.destroy(e);
+        ASSERT_TRUE(reg.pool<Name>().empty());
+    }
+
+    // 3. swap-and-pop 후에도 조회가 올바른지
+    {
+        sw::component_pool<int> pool;
+        std::vector<sw::entity> entities;
+        for (sw::u32 i = 0; i < 10; ++i)
+        {
+            entities.push_back(sw::entity{ i, 0 });
+            pool.emplace(entities.back(), static_cast<int>(i) * 10);
+        }
+
+        pool.remove(entities[2]);
+        pool.remove(entities[7]);
+        ASSERT_EQ(pool.size(), 8);
+        ASSERT_TRUE(!pool.contains(entities[2]));
+        for (sw::u32 i = 0; i < 10; ++i)
+        {
+            if (i != 2 && i != 7)
+            {
+                ASSERT_EQ(pool.get(entities[i]), static_cast<int>(i) * 10);
+            }
+        }
+
+        // 다른 세대의 엔티티는 포함되지 않음
+        ASSERT_TRUE(!pool.contains(sw::entity{ 3, 1 }));
+    }
+
+    // 4. 다중 컴포넌트 뷰
+    {
+        sw::registry reg;
+        for (int i = 0; i < 100; ++i)
+        {
+            const sw::entity e = reg.create();
+            reg.emplace<Position>(e, 0.0f, 0.0f);
+            if (i % 2 == 0)
+            {
+                reg.emplace<Velocity>(e, 1.0f, 2.0f);
+            }
+        }
+
+        int visited = 0;
+        reg.view<Position, Velocity>().each([&](Position& p, const Velocity& v)
+        {
+            p.x += v.x;
+            p.y += v.y;
+            ++visited;
+        });
+        ASSERT_EQ(visited, 50);
+
+        float sum = 0.0f;
+        reg.view<Position>().each([&](sw::entity, const Position& p) { sum += p.x + p.y; });
+        ASSERT_EQ(sum, 150.0f);
+
+        // 풀이 없는 컴포넌트가 섞인 뷰는 비어 있음
+        int none = 0;
+        reg.view<Position, Name>().each([&](Position&, Name&) { ++none; });
+        ASSERT_EQ(none, 0);
+    }
+
+    // 5. Archetype 테이블 (SoA)
+    {
+        sw::archetype_table<Position, Velocity, Name> table;
+        for (sw::u32 i = 0; i < 40; ++i)
+        {
+            table.emplace_back(sw::entity{ i, 0 }, Position{ static_cast<float>(i), 0.0f }, Velocity{ 1.0f, 1.0f }, Name{ std::to_string(i) });
+        }
+        ASSERT_EQ(table.size(), 40);
+
+        // 컬럼 정렬 확인
+        const auto pos = table.column<Position>();
+        const auto vel = table.column<Velocity>();
+        ASSERT_EQ(reinterpret_cast<sw::usize>(pos.data()) % sw::archetype_table<Position>::column_alignment, 0);
+        ASSERT_EQ(reinterpret_cast<sw::usize>(vel.data()) % sw::archetype_table<Position>::column_alignment, 0);
+
+        for (sw::usize i = 0; i < table.size(); ++i)
+        {
+            pos[i].x += vel[i].x;
+        }
+        ASSERT_EQ(table.get<Position>(5).x, 6.0f);
+
+        // 중간 행 삭제 시 마지막 행이 옮겨짐
+        const sw::entity moved = table.erase(5);
+        ASSERT_EQ(moved.index, 39);
+        ASSERT_EQ(table.size(), 39);
+        ASSERT_EQ(table.get<Name>(5).value, std::string("39"));
+        ASSERT_EQ(table.entities()[5].index, 39);
+
+        ASSERT_TRUE(table.erase(table.size() - 1) == sw::null_entity);
+
+        auto other = std::move(table);
+        ASSERT_EQ(other.size(), 38);
+        ASSERT_TRUE(table.empty());
+    }
+
+    // 6. 컴포넌트 생성자가 던지면 엔티티가 등록되지 않음
+    {
+        sw::registry reg;
+        const sw::entity e = reg.create();
+        bool thrown = false;
+        try
+        {
+            reg.emplace<Throwing>(e, true);
+        }
+        catch (const std::runtime_error&)
+        {
+            thrown = true;
+        }
+        ASSERT_TRUE(thrown);
+        ASSERT_TRUE(!reg.has<Throwing>(e));
+        ASSERT_TRUE(reg.pool<Throwing>().empty());
+
+        int visited = 0;
+        reg.view<Throwing>().each([&](Throwing&) { ++visited; });
+        ASSERT_EQ(visited, 0);
+
+        reg.emplace<Throwing>(e, false);
+        ASSERT_TRUE(reg.has<Throwing>(e));
+        ASSERT_TRUE(reg.destroy(e));
+    }
+
+    // 7. 행 생성 중 던지면 행이 추가되지 않고, 이미 생성된 컬럼 값은 파괴됨
+    {
+        sw::archetype_table<Name, Throwing> table;
+        table.emplace_back(sw::entity{ 0, 0 }, Name{ "a" }, false);
+        for (bool grow : { false, true })
+        {
+            if (grow)
+            {
+                while (table.size() < table.capacity())
+                {
+                    table.emplace_back(sw::entity{ static_cast<sw::u32>(table.size()), 0 }, Name{ "fill" }, false);
+                }
+            }
+
+            const sw::usize before = table.size();
+            bool thrown = false;
+            try
+            {
+                table.emplace_back(sw::entity{ 99, 0 }, Name{ std::string(64, 'x') }, true);
+            }
+            catch (const std::runtime_error&)
+            {
+                thrown = true;
+            }
+            ASSERT_TRUE(thrown);
+            ASSERT_EQ(table.size(), before);
+            ASSERT_EQ(table.entities().size(), before);
+        }
+        ASSERT_EQ(table.get<Name>(0).value, std::string("a"));
+    }
+
+    // 8. 용량이 찬 상태에서 자기 자신의 행을 인자로 넘겨도 안전함
+    {
+        sw::archetype_table<Name> table;
+        table.emplace_back(sw::entity{ 0, 0 }, Name{ std::string(64, 'n') });
+        while (table.size() < table.capacity())
+        {
+            table.emplace_back(sw::entity{ static_cast<sw::u32>(table.size()), 0 }, table.get<Name>(0));
+        }
+        table.emplace_back(sw::entity{ 100, 0 }, table.get<Name>(0));
+        ASSERT_EQ(table.get<Name>(table.size() - 1).value, std::string(64, 'n'));
+    }
+}
+
+TEST_MAIN
@@ -0,0 +1,111 @@
+#include <string_view>
+
+#include "sw/enum_reflection.hpp"
+#include "utils.hpp"
+
+namespace proto
+{
+enum class message_type : sw::u8
+{
+    hello,
+    ping,
+    pong,
+    data = 10,
+    goodbye = 100,
+};
+
+enum class status : int
+{
+    error = -2,
+    pending = -1,
+    ok = 0,
+    retry = 3,
+};
+
+enum legacy : unsigned
+{
+    legacy_first = 1,
+    legacy_second,
+};
+
+enum class empty : int
+{
+};
+
+enum class http_status : sw::u16
+{
+    ok = 200,
+    not_found = 404,
+    internal_error = 500,
+};
+}
+
+template <>
+struct sw::enum_range<proto::http_status>
+{
+    static constexpr sw::i64 min = 100;
+    static constexpr sw::i64 max = 599;
+};
+
+void run_tests()
+{
+    using proto::message_type;
+    using proto::status;
+
+    // 1. 열거자 목록과 이름 (값 오름차순)
+    {
+        static_assert(sw::enum_count<message_type>() == 5);
+        static_assert(sw::enum_values<message_type>()[3] == message_type::data);
+        static_assert(sw::enum_names<message_type>()[4] == "goodbye");
+        static_assert(sw::enum_name(message_type::pong) == "pong");
+
+        ASSERT_EQ(sw::enum_name(message_type::goodbye), "goodbye");
+        ASSERT_EQ(sw::enum_name(static_cast<message_type>(5)), ""); // 이름 없는 값
+        ASSERT_EQ(sw::enum_name(static_cast<message_type>(250)), ""); // 범위 밖
+
+        static_assert(sw::enum_count<status>() == 4);
+        ASSERT_EQ(sw::enum_name(status::error), "error");
+        ASSERT_TRUE(sw::enum_values<status>().front() == status::error);
+
+        // unscoped enum, 이름만 추출
+        ASSERT_EQ(sw::enum_name(proto::legacy_second), "legacy_second");
+        static_assert(sw::enum_count<proto::empty>() == 0);
+    }
+
+    // 2. 문자열 → 열거자 (perfect hash)
+    {
+        static_assert(sw::enum_cast<message_type>("ping") == message_type::ping);
+        for (const message_type value : sw::enum_values<message_type>())
+        {
+            ASSERT_TRUE(sw::enum_cast<message_type>(sw::enum_name(value)) == value);
+        }
+        for (const status value : sw::enum_values<status>())
+        {
+            ASSERT_TRUE(sw::enum_cast<status>(sw::enum_name(value)) == value);
+        }
+
+        ASSERT_TRUE(!sw::enum_cast<message_type>("pin").has_value());
+        ASSERT_TRUE(!sw::enum_cast<message_type>("pings").has_value());
+        ASSERT_TRUE(!sw::enum_cast<message_type>("").has_value());
+        ASSERT_TRUE(!sw::enum_cast<status>("hello").has_value());
+        ASSERT_TRUE(!sw::enum_cast<proto::empty>("anything").has_value());
+    }
+
+    // 3. 정수 → 열거자
+    {
+        ASSERT_TRUE(sw::enum_cast<message_type>(10) == message_type::data);
+        ASSERT_TRUE(!sw::enum_cast<message_type>(11).has_value());
+        ASSERT_TRUE(!sw::enum_cast<message_type>(-1).has_value());
+        ASSERT_TRUE(sw::enum_cast<status>(-1) == status::pending);
+        ASSERT_TRUE(!sw::enum_cast<status>(1'000'000'000'000LL).has_value());
+    }
+
+    // 4. enum_range 특수화로 탐색 범위 확장
+    {
+        static_assert(sw::enum_count<proto::http_status>() == 3);
+        ASSERT_EQ(sw::enum_name(proto::http_status::not_found), "not_found");
+        ASSERT_TRUE(sw::enum_cast<proto::http_status>("internal_error") == proto::http_status::internal_error);
+    }
+}
+
+TEST_MAIN
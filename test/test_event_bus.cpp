@@ -0,0 +1,116 @@
+#include <string>
+#include <vector>
+
+#include "sw/event_bus.hpp"
+#include "utils.hpp"
+
+struct DamageEvent
+{
+    int amount;
+};
+
+struct ChatEvent
+{
+    std::string text;
+};
+
+void run_tests()
+{
+    // 1. 즉시 전달
+    {
+        sw::event_bus bus;
+        int total = 0;
+        auto handle = bus.subscribe<DamageEvent>([&](const DamageEvent& e) { total += e.amount; });
+        ASSERT_TRUE(handle);
+
+        bus.publish(DamageEvent{ 10 });
+        bus.publish(DamageEvent{ 5 });
+        ASSERT_EQ(total, 15);
+
+        // 다른 타입의 이벤트는 전달되지 않음
+        bus.publish(ChatEvent{ "hello" });
+        ASSERT_EQ(total, 15);
+
+        ASSERT_TRUE(bus.unsubscribe(handle));
+        ASSERT_TRUE(!bus.unsubscribe(handle));
+        bus.publish(DamageEvent{ 100 });
+        ASSERT_EQ(total, 15);
+    }
+
+    // 2. 대기열 + 일괄 전달 (핸들러 단위로 이벤트를 모아서 처리)
+    {
+        sw::event_bus bus;
+        std::vector<std::string> log;
+        bus.subscribe<DamageEvent>([&](const DamageEvent& e) { log.push_back("a" + std::to_string(e.amount)); });
+        bus.subscribe<DamageEvent>([&](const DamageEvent& e) { log.push_back("b" + std::to_string(e.amount)); });
+        bus.subscribe<ChatEvent>([&](const ChatEvent& e) { log.push_back(e.text); });
+
+        bus.enqueue(DamageEvent{ 1 });
+        bus.enqueue(ChatEvent{ "hi" });
+        bus.emplace<DamageEvent>(2);
+        ASSERT_EQ(bus.pending<DamageEvent>(), 2);
+        ASSERT_EQ(bus.pending<ChatEvent>(), 1);
+        ASSERT_TRUE(log.empty());
+
+        bus.dispatch();
+        ASSERT_EQ(bus.pending<DamageEvent>(), 0);
+
+        const std::vector<std::string> expected = { "a1", "a2", "b1", "b2", "hi" };
+        ASSERT_TRUE(log == expected);
+    }
+
+    // 3. 타입별 dispatch, 핸들러 안에서 enqueue
+    {
+        sw::event_bus bus;
+        int count = 0;
+        bus.subscribe<DamageEvent>([&](const DamageEvent& e)
+        {
+            ++count;
+            if (e.amount > 0)
+            {
+                bus.enqueue(DamageEvent{ e.amount - 1 });
+            }
+        });
+
+        bus.enqueue(DamageEvent{ 2 });
+        bus.enqueue(ChatEvent{ "ignored" });
+        bus.dispatch<DamageEvent>();
+        ASSERT_EQ(count, 1);
+        ASSERT_EQ(bus.pending<DamageEvent>(), 1);
+        ASSERT_EQ(bus.pending<ChatEvent>(), 1);
+
+        bus.dispatch<DamageEvent>();
+        bus.dispatch<DamageEvent>();
+        ASSERT_EQ(count, 3);
+        ASSERT_EQ(bus.pending<DamageEvent>(), 0);
+
+        bus.clear_queues();
+        ASSERT_EQ(bus.pending<ChatEvent>(), 0);
+    }
+
+    // 4. 핸들러 안에서 subscribe / unsubscribe
+    {
+        sw::event_bus bus;
+        int first = 0;
+        int second = 0;
+        sw::event_handle self;
+        self = bus.subscribe<DamageEvent>([&](const DamageEvent&)
+        {
+            ++first;
+            bus.unsubscribe(self);
+            bus.subscribe<DamageEvent>([&](const DamageEvent&) { ++second; });
+        });
+
+        bus.enqueue(DamageEvent{ 1 });
+        bus.enqueue(DamageEvent{ 2 });
+        bus.dispatch();
+        ASSERT_EQ(first, 1);
+        ASSERT_EQ(second, 0);
+
+        bus.publish(DamageEvent{ 3 });
+        ASSERT_EQ(first, 1);
+        ASSERT_EQ(second, 1);
+    }
+}
+
+TEST_MAIN
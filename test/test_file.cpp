@@ -0,0 +1,162 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+#include "sw/file.hpp"
+#include "sw/serialize.hpp"
+#include "utils.hpp"
+
+namespace
+{
+std::filesystem::path temp_path(const char* name)
+{
+    return std::filesystem::temp_directory_path() / name;
+}
+
+std::vector<std::byte> make_pattern(sw::usize size)
+{
+    std::vector<std::byte> bytes(size);
+    for (sw::usize i = 0; i < size; ++i)
+    {
+        bytes[i] = static_cast<std::byte>((i * 31 + 7) & 0xFF);
+    }
+    return bytes;
+}
+
+void write_file(const std::filesystem::path& path, const std::vector<std::byte>& bytes)
+{
+    std::ofstream out{ path, std::ios::binary | std::ios::trunc };
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+using record = std::tuple<sw::u32, std::vector<sw::u64>>;
+} // namespace
+
+void run_tests()
+{
+    const auto path = temp_path("swlib_test_file.bin");
+    const auto pattern = make_pattern(100'000);
+    write_file(path, pattern);
+
+    // 1. 읽기 전용 매핑
+    {
+        sw::mapped_file file{ path, sw::file_access::read_only, sw::access_pattern::sequential };
+        ASSERT_TRUE(file.is_open());
+        ASSERT_TRUE(!file.is_writable());
+        ASSERT_EQ(file.size(), pattern.size());
+        ASSERT_TRUE(std::memcmp(file.bytes().data(), pattern.data(), pattern.size()) == 0);
+
+        file.advise(sw::access_pattern::random, 5000, 100);
+        file.advise(sw::access_pattern::will_need);
+        ASSERT_EQ(file.bytes()[12345], pattern[12345]);
+
+        sw::mapped_file moved{ std::move(file) };
+        ASSERT_TRUE(!file.is_open());
+        ASSERT_TRUE(file.bytes().empty());
+        ASSERT_EQ(moved.size(), pattern.size());
+    }
+
+    // 2. 읽기/쓰기 매핑: 수정 내용이 파일에 반영됨
+    {
+        {
+            sw::mapped_file file{ path, sw::file_access::read_write };
+            file.writable_bytes()[0] = std::byte{ 0xEE };
+            file.flush();
+        }
+        sw::mapped_file file{ path };
+        ASSERT_EQ(file.bytes()[0], std::byte{ 0xEE });
+        ASSERT_EQ(file.bytes()[1], pattern[1]);
+        write_file(path, pattern);
+    }
+
+    // 3. 빈 파일과 없는 파일
+    {
+        const auto empty_path = temp_path("swlib_test_file_empty.bin");
+        write_file(empty_path, {});
+        sw::mapped_file file{ empty_path };
+        ASSERT_TRUE(file.is_open());
+        ASSERT_TRUE(file.empty());
+        file.close();
+        std::filesystem::remove(empty_path);
+
+        bool thrown = false;
+        try
+        {
+            sw::mapped_file missing{ temp_path("swlib_test_file_missing.bin") };
+        }
+        catch (const std::system_error& error)
+        {
+            thrown = error.code() == std::errc::no_such_file_or_directory;
+        }
+        ASSERT_TRUE(thrown);
+    }
+
+    // 4. create로 만든 파일에 직접 직렬화하고 매핑한 채로 읽기
+    {
+        const auto flat_path = temp_path("swlib_test_file_flat.bin");
+        const record original{ 7, { 1, 2, 3, 4, 5 } };
+        {
+            auto file = sw::mapped_file::create(flat_path, sw::serialized_size(original));
+            sw::serialize_to(original, file.writable_bytes());
+            file.flush();
+        }
+
+        sw::mapped_file file{ flat_path };
+        sw::flat_view<record> view{ file.bytes() };
+        ASSERT_EQ(view.get<0>(), 7);
+        ASSERT_EQ(view.get<1>().size(), 5);
+        ASSERT_EQ(view.get<1>()[4], 5);
+        file.close();
+        std::filesystem::remove(flat_path);
+    }
+
+    // 5. chunked_reader: 청크를 이어 붙이면 원본과 같음
+    {
+        sw::chunked_reader reader{ path, 4096 };
+        ASSERT_EQ(reader.size(), pattern.size());
+        ASSERT_EQ(reader.chunk_capacity(), 4096);
+
+        std::vector<std::byte> collected;
+        sw::usize chunks = 0;
+        while (true)
+        {
+            auto chunk = reader.next();
+            if (chunk.empty())
+            {
+                break;
+            }
+            ASSERT_EQ(reader.chunk_offset(), collected.size());
+            ASSERT_EQ(reinterpret_cast<sw::usize>(chunk.data()) % sw::chunked_reader::buffer_alignment, 0);
+            collected.insert(collected.end(), chunk.begin(), chunk.end());
+            ++chunks;
+        }
+        ASSERT_EQ(chunks, (pattern.size() + 4095) / 4096);
+        ASSERT_TRUE(collected == pattern);
+        ASSERT_TRUE(reader.next().empty());
+
+        // 위치 이동 후 다시 읽기
+        reader.seek(pattern.size() - 10);
+        auto tail = reader.next();
+        ASSERT_EQ(tail.size(), 10);
+        ASSERT_EQ(tail[9], pattern.back());
+        ASSERT_TRUE(reader.next().empty());
+
+        reader.seek(0);
+        ASSERT_EQ(reader.next()[0], pattern[0]);
+        reader.seek(4096 * 2);
+        ASSERT_EQ(reader.next()[0], pattern[4096 * 2]);
+    }
+
+    // 6. 청크 크기는 정렬 단위로 올림
+    {
+        sw::chunked_reader reader{ path, 1000 };
+        ASSERT_EQ(reader.chunk_capacity(), 4096);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_MAIN
@@ -0,0 +1,179 @@
+#include <filesystem>
+#include <format>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sw/log.hpp"
+#include "utils.hpp"
+
+namespace test_ns
+{
+struct Vec2
+{
+    float x, y;
+};
+}
+
+template <>
+struct std::formatter<test_ns::Vec2>
+{
+    constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+    auto format(const test_ns::Vec2& v, std::format_context& ctx) const
+    {
+        return std::format_to(ctx.out(), "({}, {})", v.x, v.y);
+    }
+};
+
+namespace
+{
+/** 백그라운드 스레드가 전달한 로그를 모으는 sink */
+struct capture
+{
+    std::mutex mutex;
+    std::vector<std::string> messages;
+    std::vector<sw::log_level> levels;
+
+    sw::logger::sink_type sink()
+    {
+        return [this](const sw::log_entry& entry)
+        {
+            std::scoped_lock lock{ mutex };
+            messages.emplace_back(entry.message);
+            levels.push_back(entry.level);
+        };
+    }
+};
+}
+
+void run_tests()
+{
+    auto& logger = sw::logger::instance();
+    logger.set_console(nullptr);
+
+    capture captured;
+    logger.add_sink(captured.sink());
+
+    // 1. 기본 타입 인자, 포맷 지정자, 위치 인자, 중괄호 이스케이프
+    {
+        const std::string name = "swlib";
+        const char* literal = "literal";
+        int value = 255;
+        SW_LOG_INFO("hello {} {}", name, 42);
+        SW_LOG_WARN("hex={:x} pi={:.2f} flag={} c={}", value, 3.14159, true, 'z');
+        SW_LOG_ERROR("{1} before {0}, {{braces}}", "first", literal);
+        SW_LOG_INFO("no arguments");
+        logger.flush();
+
+        ASSERT_EQ(captured.messages.size(), 4);
+        ASSERT_EQ(captured.messages[0], std::string("hello swlib 42"));
+        ASSERT_EQ(captured.messages[1], std::string("hex=ff pi=3.14 flag=true c=z"));
+        ASSERT_EQ(captured.messages[2], std::string("literal before first, {braces}"));
+        ASSERT_EQ(captured.messages[3], std::string("no arguments"));
+        ASSERT_TRUE(captured.levels[1] == sw::log_level::warn);
+    }
+
+    // 2. 수준 필터링: 걸러진 호출은 인자를 평가하지 않음
+    {
+        captured.messages.clear();
+        int evaluated = 0;
+        const auto count = [&] { return ++evaluated; };
+
+        logger.set_level(sw::log_level::warn);
+        SW_LOG_DEBUG("skipped {}", count());
+        SW_LOG_ERROR("kept {}", count());
+        logger.set_level(sw::log_level::info);
+        logger.flush();
+
+        ASSERT_EQ(evaluated, 1);
+        ASSERT_EQ(captured.messages.size(), 1);
+        ASSERT_EQ(captured.messages[0], std::string("kept 1"));
+    }
+
+    // 3. 사용자 타입 (trivially copyable + std::formatter)
+    {
+        captured.messages.clear();
+        SW_LOG_INFO("position {}", test_ns::Vec2{ 1.5f, -2.0f });
+        logger.flush();
+        ASSERT_EQ(captured.messages.size(), 1);
+        ASSERT_EQ(captured.messages[0], std::string("position (1.5, -2)"));
+    }
+
+    // 4. 여러 스레드의 기록이 모두 전달됨
+    {
+        captured.messages.clear();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([t]
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    SW_LOG_INFO("thread {} message {}", t, i);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        logger.flush();
+        ASSERT_EQ(captured.messages.size() + logger.dropped(), 4000);
+    }
+
+    // 5. 바이너리 파일 저장과 오프라인 디코딩
+    {
+        const auto path = std::filesystem::temp_directory_path() / "sw_test_log.swlog";
+        ASSERT_TRUE(logger.open_binary_file(path));
+        SW_LOG_INFO("binary {} {:.1f} {}", 7u, 2.25, std::string_view{ "text" });
+        SW_LOG_ERROR("custom {}", test_ns::Vec2{ 0.0f, 1.0f });
+        SW_LOG_INFO("binary {} {:.1f} {}", 8u, 0.5, std::string_view{ "again" });
+        logger.close_binary_file();
+
+        sw::log_decoder decoder{ path };
+        ASSERT_TRUE(decoder.is_valid());
+
+        std::vector<std::string> decoded;
+        std::vector<sw::log_level> levels;
+        while (const sw::log_entry* entry = decoder.next())
+        {
+            decoded.emplace_back(entry->message);
+            levels.push_back(entry->level);
+            ASSERT_TRUE(entry->file.ends_with("test_log.cpp"));
+        }
+        ASSERT_EQ(decoded.size(), 3);
+        ASSERT_EQ(decoded[0], std::string("binary 7 2.2 text"));
+        // 오프라인에서는 사용자 타입의 formatter가 없으므로 타입 이름으로 표시
+        ASSERT_EQ(decoded[1], std::string("custom <test_ns::Vec2>"));
+        ASSERT_EQ(decoded[2], std::string("binary 8 0.5 again"));
+        ASSERT_TRUE(levels[1] == sw::log_level::error);
+
+        std::filesystem::remove(path);
+    }
+
+    // 6. 파괴된 로거와 같은 주소에 생성된 로거도 자기 링을 사용
+    {
+        std::optional<sw::logger> local;
+        for (int round = 0; round < 3; ++round)
+        {
+            capture local_captured;
+            local.emplace(4096);
+            local->set_console(nullptr);
+            local->add_sink(local_captured.sink());
+
+            static constexpr sw::internal::log_location location{ sw::log_level::info, "round {}", sw::fnv1a("round {}"), __FILE__, __LINE__ };
+            local->write(location, round);
+            local->flush();
+            ASSERT_EQ(local_captured.messages.size(), 1);
+            ASSERT_EQ(local_captured.messages[0], std::format("round {}", round));
+            local.reset();
+        }
+    }
+
+    logger.clear_sinks();
+}
+
+TEST_MAIN
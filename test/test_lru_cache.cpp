@@ -0,0 +1,145 @@
+#include <atomic>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sw/lru_cache.hpp"
+#include "utils.hpp"
+
+void run_tests()
+{
+    // 1. LRU: 가장 오래 쓰지 않은 항목부터 내보냄
+    {
+        sw::lru_cache<int, std::string> cache{ 3, sw::eviction_policy::lru, 1 };
+        ASSERT_EQ(cache.shard_count(), 1);
+        ASSERT_EQ(cache.capacity(), 3);
+
+        ASSERT_TRUE(cache.put(1, "one"));
+        ASSERT_TRUE(cache.put(2, "two"));
+        ASSERT_TRUE(cache.put(3, "three"));
+        ASSERT_EQ(cache.get(1).value(), "one"); // 1이 가장 최근이 됨
+
+        cache.put(4, "four"); // 2를 내보냄
+        ASSERT_TRUE(!cache.contains(2));
+        ASSERT_TRUE(cache.contains(1));
+        ASSERT_TRUE(cache.contains(3));
+        ASSERT_EQ(cache.size(), 3);
+
+        cache.put(3, "THREE"); // 교체하면 가장 최근이 됨
+        cache.put(5, "five");  // 1을 내보냄
+        ASSERT_TRUE(!cache.contains(1));
+        ASSERT_EQ(cache.get(3).value(), "THREE");
+        ASSERT_TRUE(!cache.get(2));
+
+        const auto stats = cache.stats();
+        ASSERT_EQ(stats.hits, 2);
+        ASSERT_EQ(stats.misses, 1);
+        ASSERT_EQ(stats.evictions, 2);
+
+        ASSERT_TRUE(cache.erase(3));
+        ASSERT_TRUE(!cache.erase(3));
+        ASSERT_EQ(cache.size(), 2);
+        cache.clear();
+        ASSERT_TRUE(cache.empty());
+    }
+
+    // 2. CLOCK: 참조된 항목은 한 번 더 기회를 얻음
+    {
+        sw::lru_cache<int, int> cache{ 3, sw::eviction_policy::clock, 1 };
+        cache.put(1, 10);
+        cache.put(2, 20);
+        cache.put(3, 30);
+        ASSERT_EQ(cache.get(1).value(), 10);
+
+        cache.put(4, 40); // 1은 참조되어 살아남고 2를 내보냄
+        ASSERT_TRUE(cache.contains(1));
+        ASSERT_TRUE(!cache.contains(2));
+
+        cache.put(5, 50); // 참조 비트가 지워진 뒤이므로 3을 내보냄
+        ASSERT_TRUE(!cache.contains(3));
+        ASSERT_TRUE(cache.contains(1));
+        ASSERT_EQ(cache.size(), 3);
+    }
+
+    // 3. 바이트 비용 제한
+    {
+        auto bytes = [](const std::string& key, const std::string& value) { return key.size() + value.size(); };
+        sw::lru_cache<std::string, std::string, decltype(bytes)> cache{ 100, sw::eviction_policy::lru, 1, bytes };
+
+        cache.put("a", std::string(40, 'a')); // 41
+        cache.put("b", std::string(40, 'b')); // 41
+        ASSERT_EQ(cache.total_cost(), 82);
+        cache.put("c", std::string(30, 'c')); // 31: a를 내보냄
+        ASSERT_TRUE(!cache.contains("a"));
+        ASSERT_EQ(cache.total_cost(), 72);
+
+        // 용량보다 큰 항목은 저장하지 않고 기존 값도 제거
+        ASSERT_TRUE(!cache.put("b", std::string(200, 'x')));
+        ASSERT_TRUE(!cache.contains("b"));
+        ASSERT_EQ(cache.total_cost(), 31);
+    }
+
+    // 4. 많은 항목: 인덱스 재해시와 삭제 후에도 조회가 정확함
+    {
+        sw::lru_cache<sw::u64, sw::u64> cache{ 100000, sw::eviction_policy::lru, 4 };
+        for (sw::u64 i = 0; i < 50000; ++i)
+        {
+            cache.put(i, i * 3);
+        }
+        for (sw::u64 i = 0; i < 50000; i += 3)
+        {
+            ASSERT_TRUE(cache.erase(i));
+        }
+        for (sw::u64 i = 0; i < 50000; ++i)
+        {
+            const auto value = cache.get(i);
+            ASSERT_EQ(value.has_value(), i % 3 != 0);
+            if (value)
+            {
+                ASSERT_EQ(*value, i * 3);
+            }
+        }
+        ASSERT_TRUE(cache.size() == 50000 - 16667);
+    }
+
+    // 5. 여러 스레드에서 동시에 조회/저장
+    for (const auto policy : { sw::eviction_policy::lru, sw::eviction_policy::clock })
+    {
+        sw::lru_cache<sw::u64, sw::u64> cache{ 4096, policy };
+        std::atomic<bool> wrong = false;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; ++t)
+        {
+            threads.emplace_back([&, t]
+            {
+                std::mt19937_64 rng(t);
+                for (int i = 0; i < 50000; ++i)
+                {
+                    const sw::u64 key = rng() % 10000;
+                    if (auto value = cache.get(key))
+                    {
+                        wrong = wrong || *value != key + 1;
+                    }
+                    else
+                    {
+                        cache.put(key, key + 1);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_TRUE(!wrong);
+        ASSERT_TRUE(cache.total_cost() <= cache.capacity());
+        ASSERT_TRUE(cache.capacity() <= 4096);
+        const auto stats = cache.stats();
+        ASSERT_EQ(stats.hits + stats.misses, 8 * 50000);
+        ASSERT_TRUE(stats.hits > 0);
+    }
+}
+
+TEST_MAIN
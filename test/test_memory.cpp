@@ -1,6 +1,18 @@
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "sw/memory.hpp"
 #include "utils.hpp"
 
+struct Owner
+{
+    std::unique_ptr<int> value;
+};
+
+SW_TRIVIALLY_RELOCATABLE(Owner);
+
 void run_tests()
 {
     // Basic alignment
@@ -19,6 +31,138 @@ void run_tests()
         char c;
     };
     ASSERT_EQ((sw::aligned_size<S, 32>()), 32);
+
+    // Relocation (trivially relocatable: memcpy)
+    {
+        alignas(Owner) std::byte src_buffer[sizeof(Owner) * 3];
+        alignas(Owner) std::byte dst_buffer[sizeof(Owner) * 3];
+        auto* src = reinterpret_cast<Owner*>(src_buffer);
+        auto* dst = reinterpret_cast<Owner*>(dst_buffer);
+        for (int i = 0; i < 3; ++i)
+        {
+            std::construct_at(src + i, Owner{ std::make_unique<int>(i) });
+        }
+
+        Owner* end = sw::uninitialized_relocate_n(src, 3, dst);
+        ASSERT_TRUE(end == dst + 3);
+        ASSERT_EQ(*dst[2].value, 2);
+        std::destroy_n(dst, 3);
+    }
+
+    // Relocation (일반 타입: 이동 생성 + 파괴)
+    {
+        alignas(std::string) std::byte src_buffer[sizeof(std::string) * 2];
+        alignas(std::string) std::byte dst_buffer[sizeof(std::string) * 2];
+        auto* src = reinterpret_cast<std::string*>(src_buffer);
+        auto* dst = reinterpret_cast<std::string*>(dst_buffer);
+        std::construct_at(src, "short");
+        std::construct_at(src + 1, "a string that is long enough to live on the heap");
+
+        sw::uninitialized_relocate(src, src + 2, dst);
+        ASSERT_EQ(dst[0], std::string("short"));
+        ASSERT_EQ(dst[1].size(), 48);
+
+        std::string value = sw::relocate(dst);
+        ASSERT_EQ(value, std::string("short"));
+
+        sw::relocate_at(dst + 1, src);
+        ASSERT_EQ(src->size(), 48);
+        std::destroy_at(src);
+    }
+
+    // Cache line padding
+    static_assert(sw::cache_line_size == SW_CACHE_LINE_SIZE);
+    static_assert(alignof(sw::cache_padded<char>) == sw::cache_line_size);
+    static_assert(sizeof(sw::cache_padded<sw::u64>) == sw::cache_line_size);
+    {
+        struct Counters
+        {
+            sw::cache_padded<std::atomic<sw::u64>> a;
+            sw::cache_padded<std::atomic<sw::u64>> b;
+        };
+        Counters counters;
+        const auto distance = reinterpret_cast<sw::usize>(&counters.b.value) - reinterpret_cast<sw::usize>(&counters.a.value);
+        ASSERT_TRUE(distance >= sw::cache_line_size);
+
+        counters.a->fetch_add(3);
+        ASSERT_EQ(counters.a.get().load(), 3);
+
+        sw::cache_padded<int> padded = 5;
+        ASSERT_EQ(*padded, 5);
+    }
+
+    // Arena: 정렬 및 범프 할당
+    {
+        sw::arena arena{ 256 };
+        auto* a = static_cast<sw::u8*>(arena.allocate(1, 1));
+        auto* b = arena.allocate(8, 64);
+        ASSERT_TRUE(a != nullptr);
+        ASSERT_EQ(reinterpret_cast<sw::usize>(b) % 64, 0);
+
+        auto* values = arena.allocate_array<sw::u32>(4);
+        ASSERT_EQ(reinterpret_cast<sw::usize>(values) % alignof(sw::u32), 0);
+
+        struct Pair
+        {
+            int x, y;
+        };
+        const Pair* p = arena.create<Pair>(1, 2);
+        ASSERT_EQ(p->x + p->y, 3);
+    }
+
+    // Arena: 블록 체인, 큰 할당, reset 후 재사용
+    {
+        sw::arena arena{ 128 };
+        for (int i = 0; i < 32; ++i)
+        {
+            (void)arena.allocate(32, 8);
+        }
+        const sw::usize reserved = arena.reserved_bytes();
+        ASSERT_TRUE(reserved >= 32 * 32);
+
+        void* big = arena.allocate(4096, 16);
+        ASSERT_EQ(reinterpret_cast<sw::usize>(big) % 16, 0);
+        const sw::usize reserved_with_big = arena.reserved_bytes();
+
+        arena.reset();
+        for (int i = 0; i < 32; ++i)
+        {
+            (void)arena.allocate(32, 8);
+        }
+        (void)arena.allocate(4096, 16);
+        ASSERT_EQ(arena.reserved_bytes(), reserved_with_big);
+
+        arena.release();
+        ASSERT_EQ(arena.reserved_bytes(), 0);
+    }
+
+    // Arena: marker로 되돌리기
+    {
+        sw::arena arena{ 128 };
+        (void)arena.allocate(16);
+        const auto marker = arena.get_marker();
+        void* first = arena.allocate(16);
+        for (int i = 0; i < 16; ++i)
+        {
+            (void)arena.allocate(64);
+        }
+        arena.rewind(marker);
+        ASSERT_EQ(arena.allocate(16), first);
+    }
+
+    // Arena: pmr 어댑터
+    {
+        sw::arena arena;
+        sw::arena_resource resource{ arena };
+        std::pmr::vector<int> values{ &resource };
+        for (int i = 0; i < 1000; ++i)
+        {
+            values.push_back(i);
+        }
+        ASSERT_EQ(values[999], 999);
+        ASSERT_TRUE(arena.reserved_bytes() > 0);
+        ASSERT_TRUE(&resource.get_arena() == &arena);
+    }
 }
 
 TEST_MAIN
@@ -0,0 +1,87 @@
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+#include "sw/packed_tuple.hpp"
+#include "sw/memory.hpp"
+#include "utils.hpp"
+
+namespace
+{
+struct empty_tag
+{
+    constexpr bool operator==(const empty_tag&) const = default;
+};
+
+/** 패딩이 없을 때의 이론적 최소 크기: 필드 크기 합을 최대 정렬로 올림 */
+template <typename... Ts>
+constexpr sw::usize minimum_size = sw::aligned_size((sizeof(Ts) + ... + 0), std::max({ alignof(Ts)... }));
+}
+
+void run_tests()
+{
+    using sw::u8;
+    using sw::u16;
+    using sw::u32;
+    using sw::u64;
+
+    // 1. 크기가 이론적 최소값과 같음
+    {
+        using record = sw::packed_tuple<u8, u64, u8, u32>;
+        static_assert(sizeof(std::tuple<u8, u64, u8, u32>) > sizeof(record));
+        static_assert(sizeof(record) == minimum_size<u8, u64, u8, u32>);
+        static_assert(sizeof(record) == 16);
+        static_assert(alignof(record) == alignof(u64));
+
+        static_assert(sizeof(sw::packed_tuple<u8, u16, u8, u32, u8, u64, u16>) == minimum_size<u8, u16, u8, u32, u8, u64, u16>);
+        static_assert(sizeof(sw::packed_tuple<char, double, char, float, short>) == minimum_size<char, double, char, float, short>);
+        static_assert(sizeof(sw::packed_tuple<u32, u8, empty_tag>) == 8); // 빈 타입은 공간을 차지하지 않음
+        static_assert(std::is_trivially_copyable_v<sw::packed_tuple<u8, u64, u8, u32>>);
+
+        // 저장 순서: 정렬 내림차순, 같은 정렬은 선언 순서
+        static_assert(record::storage_order == std::array<sw::usize, 4>{ 1, 3, 0, 2 });
+    }
+
+    // 2. get<I>는 선언 순서, 구조적 바인딩, constexpr
+    {
+        constexpr sw::packed_tuple<u8, u64, u8, u32> constant{ u8{ 1 }, u64{ 2 }, u8{ 3 }, u32{ 4 } };
+        static_assert(sw::get<0>(constant) == 1 && sw::get<1>(constant) == 2);
+        static_assert(sw::get<2>(constant) == 3 && sw::get<3>(constant) == 4);
+
+        sw::packed_tuple<u8, u64, u8, u32> record{ 10, 20, 30, 40 };
+        auto& [flag, id, kind, count] = record;
+        ASSERT_EQ(flag, 10);
+        ASSERT_EQ(id, 20);
+        ASSERT_EQ(kind, 30);
+        ASSERT_EQ(count, 40);
+
+        id = 99;
+        ASSERT_EQ(record.get<1>(), 99);
+        static_assert(std::is_same_v<std::tuple_element_t<3, decltype(record)>, u32>);
+        static_assert(std::tuple_size_v<decltype(record)> == 4);
+
+        // 같은 값은 같은 필드에 저장되어 비교와 변환도 선언 순서
+        ASSERT_TRUE(record.to_tuple() == std::make_tuple(u8{ 10 }, u64{ 99 }, u8{ 30 }, u32{ 40 }));
+        ASSERT_TRUE(record == (sw::packed_tuple<u8, u64, u8, u32>{ std::make_tuple(u8{ 10 }, u64{ 99 }, u8{ 30 }, u32{ 40 }) }));
+    }
+
+    // 3. trivially copyable이 아닌 필드, 이동
+    {
+        sw::packed_tuple<char, std::string, int> values{ 'a', std::string(100, 'x'), 7 };
+        auto copy = values;
+        sw::get<1>(copy) += "y";
+        ASSERT_EQ(sw::get<1>(values).size(), 100);
+        ASSERT_EQ(sw::get<1>(copy).size(), 101);
+
+        std::string moved = sw::get<1>(std::move(copy));
+        ASSERT_EQ(moved.size(), 101);
+
+        const sw::packed_tuple<u32, empty_tag> with_tag{ 5u, empty_tag{} };
+        ASSERT_EQ(sw::get<0>(with_tag), 5);
+
+        const sw::packed_tuple<> nothing;
+        ASSERT_TRUE(nothing == sw::packed_tuple<>{});
+    }
+}
+
+TEST_MAIN
@@ -0,0 +1,99 @@
+#include <barrier>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "sw/per_thread.hpp"
+#include "utils.hpp"
+
+void run_tests()
+{
+    // 1. 샤드 수는 2의 거듭제곱으로 올림
+    {
+        sw::per_thread<int> values{ 3 };
+        ASSERT_EQ(values.size(), 4);
+
+        values.local() = 10;
+        ASSERT_EQ(values.combine(0, [](int acc, int v) { return acc + v; }), 10);
+    }
+
+    // 2. 샤드 간 캐시 라인 분리
+    {
+        sw::per_thread<sw::u64> values{ 2 };
+        std::vector<const sw::u64*> addresses;
+        values.for_each([&](sw::u64& v) { addresses.push_back(&v); });
+        ASSERT_EQ(addresses.size(), 2);
+        const auto distance = reinterpret_cast<sw::usize>(addresses[1]) - reinterpret_cast<sw::usize>(addresses[0]);
+        ASSERT_TRUE(distance >= sw::cache_line_size);
+    }
+
+    // 3. 여러 스레드에서 카운터 증가 후 합산
+    {
+        sw::sharded_counter<sw::u64> counter;
+        constexpr int thread_count = 8;
+        constexpr int iterations = 100000;
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < thread_count; ++t)
+        {
+            threads.emplace_back([&counter]
+            {
+                for (int i = 0; i < iterations; ++i)
+                {
+                    counter.increment();
+                }
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        ASSERT_EQ(counter.value(), static_cast<sw::u64>(thread_count) * iterations);
+
+        counter.reset();
+        ASSERT_EQ(counter.value(), 0);
+    }
+
+    // 4. 샤드 수보다 많은 스레드가 동시에 살아 있어도 스레드마다 다른 샤드를 사용 (atomic이 아닌 T)
+    {
+        sw::per_thread<sw::u64> values{ 2 };
+        constexpr int thread_count = 16;
+        constexpr int iterations = 100000;
+
+        std::vector<const sw::u64*> addresses(thread_count);
+        std::barrier sync{ thread_count };
+        std::vector<std::thread> threads;
+        for (int t = 0; t < thread_count; ++t)
+        {
+            threads.emplace_back([&, t]
+            {
+                addresses[t] = &values.local();
+                sync.arrive_and_wait();
+                for (int i = 0; i < iterations; ++i)
+                {
+                    ++values.local();
+                }
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        ASSERT_EQ(std::set(addresses.begin(), addresses.end()).size(), thread_count);
+        ASSERT_TRUE(values.size() >= thread_count);
+        ASSERT_EQ(values.combine(sw::u64{ 0 }, [](sw::u64 acc, sw::u64 v) { return acc + v; }), static_cast<sw::u64>(thread_count) * iterations);
+    }
+
+    // 5. 종료한 스레드의 순번은 다음 스레드가 재사용
+    {
+        sw::u32 first = 0;
+        sw::u32 second = 0;
+        std::thread([&] { first = sw::internal::current_thread_slot(); }).join();
+        std::thread([&] { second = sw::internal::current_thread_slot(); }).join();
+        ASSERT_EQ(first, second);
+        ASSERT_TRUE(first != sw::internal::current_thread_slot());
+    }
+}
+
+TEST_MAIN
@@ -0,0 +1,147 @@
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sw/poly.hpp"
+#include "utils.hpp"
+
+static int g_live = 0;
+
+struct Shape
+{
+    virtual ~Shape() = default;
+    virtual int area() const = 0;
+};
+
+struct Square : Shape
+{
+    int side;
+
+    explicit Square(int s) : side(s) { ++g_live; }
+    Square(const Square& other) : side(other.side) { ++g_live; }
+    Square(Square&& other) noexcept : side(other.side) { ++g_live; }
+    ~Square() override { --g_live; }
+
+    int area() const override { return side * side; }
+};
+
+struct Big : Shape
+{
+    std::array<int, 64> data{};
+    int value;
+
+    explicit Big(int v) : value(v) { ++g_live; }
+    Big(const Big& other) : data(other.data), value(other.value) { ++g_live; }
+    ~Big() override { --g_live; }
+
+    int area() const override { return value; }
+};
+
+struct MoveOnly : Shape
+{
+    std::unique_ptr<int> ptr;
+
+    explicit MoveOnly(int v) : ptr(std::make_unique<int>(v)) {}
+
+    int area() const override { return *ptr; }
+};
+
+void run_tests()
+{
+    // 1. 인라인 저장
+    {
+        sw::poly<Shape> p = Square{ 3 };
+        ASSERT_TRUE(p);
+        ASSERT_TRUE(p.is_inline());
+        ASSERT_EQ(p->area(), 9);
+        ASSERT_TRUE(p.holds<Square>());
+        ASSERT_TRUE(!p.holds<Big>());
+        ASSERT_TRUE(p.type() == sw::type_id::get<Square>());
+    }
+    ASSERT_EQ(g_live, 0);
+
+    // 2. 힙 폴백
+    {
+        auto p = sw::poly<Shape>::make<Big>(42);
+        ASSERT_TRUE(!p.is_inline());
+        ASSERT_EQ(p->area(), 42);
+
+        auto copy = p;
+        ASSERT_EQ(copy->area(), 42);
+        ASSERT_TRUE(copy.get() != p.get());
+
+        auto moved = std::move(p);
+        ASSERT_TRUE(!p);
+        ASSERT_EQ(moved->area(), 42);
+    }
+    ASSERT_EQ(g_live, 0);
+
+    // 3. 복사/이동 (인라인)
+    {
+        sw::poly<Shape> a = Square{ 2 };
+        sw::poly<Shape> b = a;
+        ASSERT_EQ(b->area(), 4);
+        ASSERT_TRUE(b.get() != a.get());
+
+        sw::poly<Shape> c;
+        c = std::move(a);
+        ASSERT_TRUE(!a);
+        ASSERT_EQ(c->area(), 4);
+
+        c = b;
+        ASSERT_EQ(c->area(), 4);
+
+        c.swap(a);
+        ASSERT_TRUE(!c);
+        ASSERT_EQ(a->area(), 4);
+
+        a.emplace<Big>(7);
+        ASSERT_EQ(a->area(), 7);
+
+        a = nullptr;
+        ASSERT_TRUE(a == nullptr);
+    }
+    ASSERT_EQ(g_live, 0);
+
+    // 4. 연속 메모리 컨테이너
+    {
+        std::vector<sw::poly<Shape>> shapes;
+        for (int i = 0; i < 16; ++i)
+        {
+            shapes.emplace_back(Square{ i });
+        }
+        shapes.emplace_back(std::in_place_type<Big>, 100);
+
+        int total = 0;
+        for (const auto& s : shapes)
+        {
+            total += s->area();
+        }
+        ASSERT_EQ(total, 1240 + 100);
+    }
+    ASSERT_EQ(g_live, 0);
+
+    // 5. 복사 불가능한 타입
+    {
+        sw::poly<Shape> p = MoveOnly{ 5 };
+        ASSERT_EQ(p->area(), 5);
+
+        sw::poly<Shape> moved = std::move(p);
+        ASSERT_EQ(moved->area(), 5);
+
+        bool caught = false;
+        try
+        {
+            sw::poly<Shape> copy = moved;
+            (void)copy;
+        }
+        catch (const std::logic_error&)
+        {
+            caught = true;
+        }
+        ASSERT_TRUE(caught);
+    }
+}
+
+TEST_MAIN
@@ -0,0 +1,189 @@
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "sw/pool.hpp"
+#include "utils.hpp"
+
+struct Node
+{
+    static inline int live = 0;
+
+    sw::u64 key;
+    double value;
+
+    Node(sw::u64 k, double v) : key(k), value(v) { ++live; }
+    ~Node() { --live; }
+};
+
+struct alignas(64) Aligned
+{
+    sw::u8 data[16];
+};
+
+// 스레드 로컬 캐시보다 늦게 파괴되는 정적 풀
+sw::object_pool<Node> static_pool;
+
+// 스레드 로컬 캐시가 파괴된 뒤 소멸자에서 풀을 사용하는 객체
+struct late_release
+{
+    static inline bool ran = false;
+
+    Node* node = nullptr;
+
+    ~late_release()
+    {
+        static_pool.destroy(node);
+        static_pool.destroy(static_pool.create(3, 0.0));
+        ran = true;
+    }
+};
+
+void run_tests()
+{
+    // 1. 블록 크기/정렬
+    static_assert(sw::fixed_pool<1>::block_size >= sizeof(void*));
+    static_assert(sw::fixed_pool<24, 8>::block_size == 24);
+    static_assert(sw::fixed_pool<20, 16>::block_size == 32);
+
+    // 2. 할당/해제 및 재사용
+    {
+        sw::fixed_pool<48, 16> pool;
+        std::set<void*> unique;
+        std::vector<void*> blocks;
+        for (int i = 0; i < 1000; ++i)
+        {
+            void* p = pool.allocate();
+            ASSERT_EQ(reinterpret_cast<sw::usize>(p) % 16, 0);
+            unique.insert(p);
+            blocks.push_back(p);
+        }
+        ASSERT_EQ(unique.size(), 1000);
+
+        for (void* p : blocks)
+        {
+            pool.deallocate(p);
+        }
+        const sw::usize chunks = pool.chunk_count();
+
+        // 해제한 블록이 재사용되어 새 청크가 생기지 않음
+        blocks.clear();
+        for (int i = 0; i < 1000; ++i)
+        {
+            blocks.push_back(pool.allocate());
+        }
+        ASSERT_EQ(pool.chunk_count(), chunks);
+        for (void* p : blocks)
+        {
+            pool.deallocate(p);
+        }
+    }
+
+    // 3. object_pool
+    {
+        sw::object_pool<Node> pool;
+        Node* a = pool.create(1, 1.5);
+        Node* b = pool.create(2, 2.5);
+        ASSERT_EQ(Node::live, 2);
+        ASSERT_EQ(a->key + b->key, 3);
+        pool.destroy(a);
+        pool.destroy(b);
+        ASSERT_EQ(Node::live, 0);
+
+        sw::object_pool<Aligned> aligned_pool;
+        Aligned* x = aligned_pool.create();
+        ASSERT_EQ(reinterpret_cast<sw::usize>(x) % 64, 0);
+        aligned_pool.destroy(x);
+    }
+
+    // 4. 다른 스레드에서 해제 (생산자 -> 소비자)
+    {
+        sw::object_pool<Node> pool;
+        constexpr int count = 20000;
+        std::vector<Node*> nodes(count);
+
+        std::thread producer([&]
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                nodes[i] = pool.create(static_cast<sw::u64>(i), 0.0);
+            }
+            pool.flush_thread_cache();
+        });
+        producer.join();
+
+        sw::u64 sum = 0;
+        std::thread consumer([&]
+        {
+            for (Node* n : nodes)
+            {
+                sum += n->key;
+                pool.destroy(n);
+            }
+        });
+        consumer.join();
+
+        ASSERT_EQ(sum, static_cast<sw::u64>(count) * (count - 1) / 2);
+        ASSERT_EQ(Node::live, 0);
+
+        // 소비자 스레드가 종료되며 되돌린 블록을 재사용
+        const sw::usize chunks = pool.chunk_count();
+        for (int i = 0; i < count; ++i)
+        {
+            nodes[i] = pool.create(0, 0.0);
+        }
+        ASSERT_EQ(pool.chunk_count(), chunks);
+        for (Node* n : nodes)
+        {
+            pool.destroy(n);
+        }
+    }
+
+    // 5. 여러 스레드 동시 사용
+    {
+        sw::fixed_pool<32> pool;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&pool]
+            {
+                std::vector<void*> local;
+                for (int round = 0; round < 50; ++round)
+                {
+                    for (int i = 0; i < 500; ++i)
+                    {
+                        local.push_back(pool.allocate());
+                    }
+                    for (void* p : local)
+                    {
+                        pool.deallocate(p);
+                    }
+                    local.clear();
+                }
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        ASSERT_TRUE(pool.chunk_count() > 0);
+    }
+
+    // 6. 스레드 로컬 캐시가 먼저 파괴되어도 depot으로 직접 할당/해제
+    {
+        std::thread worker([]
+        {
+            // holder가 캐시보다 먼저 생성되므로 스레드 종료 시 캐시보다 나중에 파괴됨
+            thread_local late_release holder;
+            holder.node = static_pool.create(1, 0.0);
+        });
+        worker.join();
+        ASSERT_TRUE(late_release::ran);
+        ASSERT_EQ(Node::live, 0);
+
+        // 메인 스레드의 캐시도 정적 풀보다 먼저 파괴됨 (프로그램 종료 시 확인)
+        static_pool.destroy(static_pool.create(2, 0.0));
+    }
+}
+
+TEST_MAIN
@@ -0,0 +1,95 @@
+// 계측 매크로가 실제로 기록하는지 확인하므로 CMake 옵션과 관계없이 활성화
+#ifndef SW_PROFILING
+    #define SW_PROFILING true
+#endif
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sw/profiler.hpp"
+#include "utils.hpp"
+
+namespace
+{
+int busy_work(int n)
+{
+    SW_PROFILE_SCOPE("busy_work");
+    volatile int sum = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        sum = sum + i;
+    }
+    return sum;
+}
+
+usize count_occurrences(const std::string& text, std::string_view pattern)
+{
+    usize count = 0;
+    for (auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+    {
+        ++count;
+    }
+    return count;
+}
+}
+
+void run_tests()
+{
+    static_assert(sw::profiler::enabled);
+
+    // 1. 중첩 구간 기록
+    {
+        sw::profiler::clear();
+        {
+            SW_PROFILE_SCOPE("outer");
+            busy_work(1000);
+            busy_work(1000);
+        }
+        ASSERT_EQ(sw::profiler::event_count(), 3);
+
+        const std::string json = sw::profiler::chrome_trace_json();
+        ASSERT_TRUE(json.starts_with("{\"traceEvents\":["));
+        ASSERT_EQ(count_occurrences(json, "\"name\":\"busy_work\""), 2);
+        ASSERT_EQ(count_occurrences(json, "\"name\":\"outer\""), 1);
+        ASSERT_EQ(count_occurrences(json, "\"ph\":\"X\""), 3);
+    }
+
+    // 2. 여러 스레드, 청크 경계를 넘는 기록, 종료한 스레드의 기록 유지
+    {
+        sw::profiler::clear();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 3; ++t)
+        {
+            threads.emplace_back([]
+            {
+                for (int i = 0; i < 5000; ++i)
+                {
+                    SW_PROFILE_SCOPE("thread \"zone\"");
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        ASSERT_EQ(sw::profiler::event_count(), 15000);
+
+        // 이름의 따옴표는 이스케이프됨
+        const std::string json = sw::profiler::chrome_trace_json();
+        ASSERT_EQ(count_occurrences(json, "\"name\":\"thread \\\"zone\\\"\""), 15000);
+    }
+
+    // 3. 파일 저장, 비우기
+    {
+        const auto path = std::filesystem::temp_directory_path() / "sw_test_profiler_trace.json";
+        ASSERT_TRUE(sw::profiler::save_chrome_trace(path));
+        ASSERT_TRUE(std::filesystem::file_size(path) > 0);
+        std::filesystem::remove(path);
+
+        sw::profiler::clear();
+        ASSERT_EQ(sw::profiler::event_count(), 0);
+    }
+}
+
+TEST_MAIN
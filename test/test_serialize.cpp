@@ -0,0 +1,118 @@
+#include <array>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "sw/serialize.hpp"
+#include "sw/packed_tuple.hpp"
+#include "utils.hpp"
+
+namespace
+{
+struct transform
+{
+    float position[3];
+    float rotation[4];
+    sw::u32 entity;
+};
+
+bool operator==(const transform& lhs, const transform& rhs)
+{
+    return std::memcmp(&lhs, &rhs, sizeof(transform)) == 0;
+}
+}
+
+void run_tests()
+{
+    // 1. trivially copyable 집합체와 배열은 그대로 저장
+    {
+        const transform source{ { 1, 2, 3 }, { 0, 0, 0, 1 }, 42 };
+        const auto bytes = sw::serialize(source);
+        ASSERT_EQ(bytes.size(), sw::serialized_size(source));
+
+        const sw::flat_view<transform> view{ bytes };
+        ASSERT_TRUE(view.is_valid());
+        ASSERT_EQ(view->entity, 42);
+        ASSERT_TRUE(*view == source);
+        // 복사 없이 버퍼 안을 가리킴
+        ASSERT_TRUE(reinterpret_cast<const std::byte*>(&view.value()) >= bytes.data());
+        ASSERT_TRUE(reinterpret_cast<const std::byte*>(&view.value()) < bytes.data() + bytes.size());
+
+        const std::array<sw::u16, 5> numbers{ 1, 2, 3, 4, 5 };
+        const auto number_bytes = sw::serialize(numbers);
+        ASSERT_EQ((sw::flat_view<std::array<sw::u16, 5>>{ number_bytes }->at(4)), 5);
+
+        const auto packed = sw::serialize(sw::packed_tuple<sw::u8, sw::u64>{ sw::u8{ 7 }, sw::u64{ 9 } });
+        const sw::flat_view<sw::packed_tuple<sw::u8, sw::u64>> packed_view{ packed };
+        ASSERT_EQ(sw::get<1>(*packed_view), 9);
+    }
+
+    // 2. 가변 길이 필드는 오프셋 테이블로 저장하고 span/string_view로 읽음
+    {
+        using snapshot = std::tuple<sw::u64, std::vector<transform>, std::string, std::vector<double>, sw::u8>;
+
+        std::vector<transform> transforms;
+        for (sw::u32 i = 0; i < 100; ++i)
+        {
+            transforms.push_back(transform{ { float(i), 0, 0 }, { 0, 0, 0, 1 }, i });
+        }
+        const snapshot source{ 1234, transforms, "level1", {}, 5 };
+        const auto bytes = sw::serialize(source);
+
+        const sw::flat_view<snapshot> view{ bytes };
+        ASSERT_TRUE(view.is_valid());
+        ASSERT_EQ(view.get<0>(), 1234);
+        ASSERT_EQ(view.get<1>().size(), 100);
+        ASSERT_EQ(view.get<1>()[57].entity, 57);
+        ASSERT_EQ(view.get<2>(), std::string_view{ "level1" });
+        ASSERT_TRUE(view.get<3>().empty());
+        ASSERT_EQ(view.get<4>(), 5);
+        ASSERT_EQ(reinterpret_cast<sw::usize>(view.get<1>().data()) % alignof(transform), 0);
+
+        // 같은 값은 같은 바이트열
+        ASSERT_TRUE(sw::serialize(source) == bytes);
+
+        // pair, span도 지원
+        const std::vector<sw::i32> values{ -1, -2, -3 };
+        const auto pair_bytes = sw::serialize(std::pair<std::span<const sw::i32>, sw::i32>{ values, 3 });
+        const sw::flat_view<std::pair<std::span<const sw::i32>, sw::i32>> pair_view{ pair_bytes };
+        ASSERT_EQ(pair_view.get<0>()[2], -3);
+    }
+
+    // 3. 스키마, 크기, 범위가 맞지 않으면 거부
+    {
+        using snapshot = std::tuple<sw::u32, std::vector<sw::u32>>;
+        auto bytes = sw::serialize(snapshot{ 1, { 1, 2, 3 } });
+
+        ASSERT_TRUE(!(sw::flat_view<std::tuple<sw::u64, std::vector<sw::u32>>>{ bytes }));
+        ASSERT_TRUE(!(sw::flat_view<snapshot>{ std::span{ bytes }.first(bytes.size() - 1) }));
+        ASSERT_TRUE(!(sw::flat_view<snapshot>{ std::span<const std::byte>{} }));
+
+        // 배열 오프셋을 버퍼 밖으로 조작
+        auto corrupted = bytes;
+        sw::flat_header header;
+        std::memcpy(&header, corrupted.data(), sizeof(header));
+        sw::flat_array array;
+        const sw::usize slot = header.root_offset + 8;
+        std::memcpy(&array, corrupted.data() + slot, sizeof(array));
+        array.count = 1000;
+        std::memcpy(corrupted.data() + slot, &array, sizeof(array));
+        ASSERT_TRUE(!(sw::flat_view<snapshot>{ corrupted }));
+
+        // 출력 버퍼가 작으면 예외
+        std::vector<std::byte> small(8);
+        bool thrown = false;
+        try
+        {
+            sw::serialize_to(snapshot{ 1, {} }, small);
+        }
+        catch (const std::length_error&)
+        {
+            thrown = true;
+        }
+        ASSERT_TRUE(thrown);
+    }
+}
+
+TEST_MAIN
@@ -0,0 +1,96 @@
+#include <string>
+#include <vector>
+
+#include "sw/slot_map.hpp"
+#include "utils.hpp"
+
+void run_tests()
+{
+    // 1. 삽입/조회/삭제
+    {
+        sw::slot_map<std::string> map;
+        const auto a = map.insert("a");
+        const auto b = map.emplace(3, 'b');
+        const auto c = map.insert("c");
+        ASSERT_EQ(map.size(), 3);
+        ASSERT_TRUE(a && b && c);
+        ASSERT_EQ(map[b], std::string("bbb"));
+
+        ASSERT_TRUE(map.erase(a));
+        ASSERT_TRUE(!map.erase(a));
+        ASSERT_TRUE(!map.contains(a));
+        ASSERT_TRUE(map.get(a) == nullptr);
+
+        // swap-and-pop 이후에도 다른 핸들은 유효
+        ASSERT_EQ(*map.get(b), std::string("bbb"));
+        ASSERT_EQ(*map.get(c), std::string("c"));
+        ASSERT_EQ(map.size(), 2);
+    }
+
+    // 2. 슬롯 재사용 시 이전 핸들 검출
+    {
+        sw::slot_map<int> map;
+        const auto old_handle = map.insert(1);
+        map.erase(old_handle);
+        const auto new_handle = map.insert(2);
+        ASSERT_EQ(new_handle.index, old_handle.index);
+        ASSERT_TRUE(new_handle.generation != old_handle.generation);
+        ASSERT_TRUE(map.get(old_handle) == nullptr);
+        ASSERT_EQ(*map.get(new_handle), 2);
+
+        // 기본 생성된 핸들은 무효
+        ASSERT_TRUE(!map.contains(sw::slot_handle<>{}));
+    }
+
+    // 3. 재할당 후에도 핸들 유지, 밀집 배열 순회
+    {
+        sw::slot_map<int> map;
+        std::vector<sw::slot_handle<>> handles;
+        for (int i = 0; i < 1000; ++i)
+        {
+            handles.push_back(map.insert(i));
+        }
+        for (int i = 0; i < 1000; i += 2)
+        {
+            map.erase(handles[i]);
+        }
+        ASSERT_EQ(map.size(), 500);
+        for (int i = 1; i < 1000; i += 2)
+        {
+            ASSERT_EQ(map[handles[i]], i);
+        }
+
+        long long sum = 0;
+        for (int v : map)
+        {
+            sum += v;
+        }
+        ASSERT_EQ(sum, 250000);
+
+        // handle_at은 밀집 배열 위치의 핸들을 돌려줌
+        for (sw::usize i = 0; i < map.size(); ++i)
+        {
+            ASSERT_EQ(map[map.handle_at(i)], map.data()[i]);
+        }
+
+        map.clear();
+        ASSERT_TRUE(map.empty());
+        ASSERT_TRUE(!map.contains(handles[1]));
+    }
+
+    // 4. 32비트 핸들과 정수 변환
+    {
+        sw::slot_map<float, sw::u16> map;
+        const auto handle = map.insert(1.5f);
+        static_assert(sizeof(decltype(handle.to_bits())) == 4);
+
+        const auto bits = handle.to_bits();
+        const auto restored = sw::slot_handle<sw::u16>::from_bits(bits);
+        ASSERT_TRUE(restored == handle);
+        ASSERT_EQ(*map.get(restored), 1.5f);
+
+        static_assert(sizeof(sw::slot_handle<>::bits_type) == 8);
+    }
+}
+
+TEST_MAIN
@@ -0,0 +1,219 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sw/small_vector.hpp"
+#include "utils.hpp"
+
+struct Tracked
+{
+    static inline int live = 0;
+
+    int value;
+
+    Tracked(int v) : value(v) { ++live; }
+    Tracked(const Tracked& other) : value(other.value) { ++live; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++live; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) noexcept = default;
+    ~Tracked() { --live; }
+
+    bool operator==(const Tracked&) const = default;
+};
+
+/** 할당 횟수를 세는 할당자 */
+template <typename T>
+struct CountingAllocator
+{
+    using value_type = T;
+
+    int* allocations;
+
+    explicit CountingAllocator(int* counter) : allocations(counter) {}
+
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>& other) : allocations(other.allocations) {}
+
+    T* allocate(std::size_t n)
+    {
+        ++*allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    bool operator==(const CountingAllocator&) const = default;
+};
+
+void run_tests()
+{
+    // 1. 인라인 -> 힙 전환
+    {
+        sw::small_vector<int, 4> v;
+        ASSERT_TRUE(v.empty());
+        ASSERT_EQ(v.capacity(), 4);
+        for (int i = 0; i < 4; ++i)
+        {
+            v.push_back(i);
+        }
+        ASSERT_TRUE(v.is_inline());
+
+        v.push_back(4);
+        ASSERT_TRUE(!v.is_inline());
+        ASSERT_EQ(v.size(), 5);
+        for (int i = 0; i < 5; ++i)
+        {
+            ASSERT_EQ(v[i], i);
+        }
+
+        v.resize(2);
+        v.shrink_to_fit();
+        ASSERT_TRUE(v.is_inline());
+        ASSERT_EQ(v.back(), 1);
+    }
+
+    // 2. 사용자 할당자 (인라인 구간에서는 할당 없음)
+    {
+        int allocations = 0;
+        sw::small_vector<int, 8, CountingAllocator<int>> v{ CountingAllocator<int>{ &allocations } };
+        for (int i = 0; i < 8; ++i)
+        {
+            v.push_back(i);
+        }
+        ASSERT_EQ(allocations, 0);
+        v.push_back(8);
+        ASSERT_EQ(allocations, 1);
+    }
+
+    // 3. 비트리비얼 타입, 생명주기
+    {
+        {
+            sw::small_vector<Tracked, 2> v;
+            for (int i = 0; i < 10; ++i)
+            {
+                v.emplace_back(i);
+            }
+            ASSERT_EQ(Tracked::live, 10);
+
+            // 자기 원소를 참조하여 성장
+            v.shrink_to_fit();
+            v.push_back(v[0]);
+            ASSERT_EQ(v.back().value, 0);
+
+            v.erase(v.begin() + 1, v.begin() + 4);
+            ASSERT_EQ(v.size(), 8);
+            ASSERT_EQ(v[1].value, 4);
+
+            v.insert(v.begin(), Tracked{ 100 });
+            ASSERT_EQ(v.front().value, 100);
+            ASSERT_EQ(v[1].value, 0);
+
+            v.erase(v.begin());
+            ASSERT_EQ(v.front().value, 0);
+            ASSERT_EQ(Tracked::live, static_cast<int>(v.size()));
+        }
+        ASSERT_EQ(Tracked::live, 0);
+    }
+
+    // 4. 복사 / 이동 (인라인, 힙)
+    {
+        sw::small_vector<std::string, 2> inline_v = { "a", "b" };
+        sw::small_vector<std::string, 2> heap_v = { "a", "b", "c", "d" };
+
+        auto copy = heap_v;
+        ASSERT_TRUE(copy == heap_v);
+
+        auto moved_inline = std::move(inline_v);
+        ASSERT_EQ(moved_inline.size(), 2);
+        ASSERT_EQ(moved_inline[1], std::string("b"));
+        ASSERT_TRUE(inline_v.empty());
+
+        const std::string* heap_data = heap_v.data();
+        auto moved_heap = std::move(heap_v);
+        ASSERT_TRUE(moved_heap.data() == heap_data); // 힙 버퍼를 그대로 가져옴
+        ASSERT_TRUE(heap_v.empty());
+        ASSERT_TRUE(heap_v.is_inline());
+
+        moved_inline.swap(moved_heap);
+        ASSERT_EQ(moved_inline.size(), 4);
+        ASSERT_EQ(moved_heap.size(), 2);
+
+        copy = moved_heap;
+        ASSERT_TRUE(copy == moved_heap);
+    }
+
+    // 5. insert 범위 / 비교 / 예외
+    {
+        sw::small_vector<int, 4> v = { 1, 5 };
+        const std::vector<int> mid = { 2, 3, 4 };
+        v.insert(v.begin() + 1, mid.begin(), mid.end());
+        ASSERT_TRUE((v == sw::small_vector<int, 4>{ 1, 2, 3, 4, 5 }));
+
+        v.insert(v.end(), 2, 9);
+        ASSERT_EQ(v.size(), 7);
+        ASSERT_EQ(v.back(), 9);
+
+        v.resize(9, 7);
+        ASSERT_EQ(v[8], 7);
+
+        ASSERT_TRUE((sw::small_vector<int, 4>{ 1, 2 } < sw::small_vector<int, 4>{ 1, 3 }));
+
+        bool caught = false;
+        try
+        {
+            (void)v.at(100);
+        }
+        catch (const std::out_of_range&)
+        {
+            caught = true;
+        }
+        ASSERT_TRUE(caught);
+
+        int sum = 0;
+        for (int x : v)
+        {
+            sum += x;
+        }
+        ASSERT_EQ(sum, 15 + 18 + 14);
+    }
+
+    // 6. 자기 원소를 인자로 넘겨도 재할당 후 값이 올바름
+    {
+        const std::string first(32, 'a'); // SSO보다 길게 만들어 해제된 메모리 접근이 드러나도록 함
+        const std::string second(32, 'b');
+
+        sw::small_vector<std::string, 2> v{ first, second };
+        v.insert(v.begin(), 3, v[0]);
+        ASSERT_EQ(v.size(), 5);
+        for (sw::usize i = 0; i < 4; ++i)
+        {
+            ASSERT_EQ(v[i], first);
+        }
+        ASSERT_EQ(v[4], second);
+
+        v.resize(v.capacity() + 3, v[4]);
+        ASSERT_EQ(v.back(), second);
+        ASSERT_EQ(v[v.size() - 3], second);
+
+        sw::small_vector<std::string, 2> w{ first, second };
+        w.insert(w.begin() + 1, w.begin(), w.end());
+        ASSERT_EQ(w.size(), 4);
+        ASSERT_EQ(w[0], first);
+        ASSERT_EQ(w[1], first);
+        ASSERT_EQ(w[2], second);
+        ASSERT_EQ(w[3], second);
+
+        w.assign(2, w[3]); // 줄어들 때
+        ASSERT_EQ(w.size(), 2);
+        ASSERT_EQ(w[0], second);
+        ASSERT_EQ(w[1], second);
+        w.assign(w.capacity() + 1, w[1]); // 늘어날 때
+        ASSERT_EQ(w.back(), second);
+        ASSERT_EQ(w.front(), second);
+    }
+}
+
+TEST_MAIN
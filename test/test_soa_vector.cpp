@@ -0,0 +1,157 @@
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "sw/soa_vector.hpp"
+#include "utils.hpp"
+
+namespace
+{
+struct vec3
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+};
+
+/** 생성 횟수가 정해진 값에 도달하면 예외를 던지는 타입 */
+struct throwing
+{
+    static inline int budget = 1000;
+    static inline int live = 0;
+
+    throwing()
+    {
+        if (--budget < 0)
+        {
+            throw std::runtime_error("budget");
+        }
+        ++live;
+    }
+    throwing(const throwing&) : throwing() {}
+    throwing(throwing&&) noexcept { ++live; }
+    throwing& operator=(const throwing&) = default;
+    throwing& operator=(throwing&&) noexcept = default;
+    ~throwing() { --live; }
+};
+}
+
+void run_tests()
+{
+    // 1. push_back(tuple), emplace_back, 행 참조
+    {
+        sw::soa_vector<int, std::string, double> values;
+        values.push_back({ 1, "one", 1.5 });
+        values.push_back(std::tuple<int, std::string, double>{ 2, "two", 2.5 });
+        values.emplace_back(3, "three", 3.5);
+
+        ASSERT_EQ(values.size(), 3);
+        ASSERT_EQ(std::get<1>(values[1]), std::string("two"));
+
+        auto [id, name, weight] = values[2];
+        id = 30;
+        name += "!";
+        ASSERT_EQ(std::get<0>(values[2]), 30);
+        ASSERT_EQ(std::get<1>(values.back()), std::string("three!"));
+        ASSERT_EQ(weight, 3.5);
+    }
+
+    // 2. column span, 정렬, 성장 후에도 값 유지
+    {
+        sw::soa_vector<std::tuple<vec3, float, sw::u8>> particles;
+        for (int i = 0; i < 1000; ++i)
+        {
+            particles.push_back({ vec3{ float(i), 0.0f, 0.0f }, float(i), sw::u8(i) });
+        }
+
+        const std::span<float> lifetimes = particles.column<1>();
+        ASSERT_EQ(lifetimes.size(), 1000);
+        ASSERT_EQ(std::accumulate(lifetimes.begin(), lifetimes.end(), 0.0f), 499500.0f);
+        ASSERT_TRUE(particles.column<float>().data() == lifetimes.data());
+        ASSERT_EQ(particles.column<sw::u8>()[300], sw::u8(300 % 256));
+
+        // 모든 column이 캐시 라인 경계에서 시작
+        ASSERT_EQ(reinterpret_cast<sw::usize>(particles.column<0>().data()) % sw::cache_line_size, 0);
+        ASSERT_EQ(reinterpret_cast<sw::usize>(particles.column<1>().data()) % sw::cache_line_size, 0);
+        ASSERT_EQ(reinterpret_cast<sw::usize>(particles.column<2>().data()) % sw::cache_line_size, 0);
+        ASSERT_EQ(particles.column<0>()[999].x, 999.0f);
+    }
+
+    // 3. 행 단위 순회 (zip), swap_erase, pop_back, resize
+    {
+        sw::soa_vector<int, float> values;
+        for (int i = 0; i < 5; ++i)
+        {
+            values.emplace_back(i, float(i) * 0.5f);
+        }
+
+        for (auto [key, value] : values)
+        {
+            value += static_cast<float>(key);
+        }
+        ASSERT_EQ(values.column<1>()[4], 6.0f);
+
+        values.swap_erase(1); // 마지막 행(4)이 1로 이동
+        ASSERT_EQ(values.size(), 4);
+        ASSERT_EQ(values.column<0>()[1], 4);
+        values.pop_back();
+        ASSERT_EQ(values.size(), 3);
+
+        values.resize(6);
+        ASSERT_EQ(values.column<0>()[5], 0);
+        ASSERT_EQ(values.end() - values.begin(), 6);
+
+        const auto& view = values;
+        int sum = 0;
+        for (auto [key, value] : view)
+        {
+            sum += key;
+        }
+        ASSERT_EQ(sum, 0 + 4 + 2);
+    }
+
+    // 4. 복사, 이동
+    {
+        sw::soa_vector<std::unique_ptr<int>, int> owners;
+        owners.emplace_back(std::make_unique<int>(7), 1);
+        auto moved = std::move(owners);
+        ASSERT_TRUE(owners.empty());
+        ASSERT_EQ(*std::get<0>(moved[0]), 7);
+
+        sw::soa_vector<std::string, int> strings;
+        strings.emplace_back("a", 1);
+        auto copy = strings;
+        std::get<0>(copy[0]) = "b";
+        ASSERT_EQ(std::get<0>(strings[0]), std::string("a"));
+        copy = strings;
+        ASSERT_EQ(std::get<0>(copy[0]), std::string("a"));
+    }
+
+    // 5. 생성 중 예외가 나면 이미 생성한 필드를 파괴
+    {
+        {
+            sw::soa_vector<throwing, throwing> values;
+            values.resize(2);
+            ASSERT_EQ(throwing::live, 4);
+
+            throwing::budget = 1; // 다음 행의 두 번째 필드에서 실패
+            bool thrown = false;
+            try
+            {
+                values.resize(3);
+            }
+            catch (const std::runtime_error&)
+            {
+                thrown = true;
+            }
+            throwing::budget = 1000;
+            ASSERT_TRUE(thrown);
+            ASSERT_EQ(values.size(), 2);
+        }
+        ASSERT_EQ(throwing::live, 0);
+    }
+}
+
+TEST_MAIN
@@ -0,0 +1,185 @@
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sw/spsc_ring.hpp"
+#include "utils.hpp"
+
+void run_tests()
+{
+    // 1. 단일 원소 push/pop, 용량 올림
+    {
+        sw::spsc_ring<std::string> ring{ 3 };
+        ASSERT_EQ(ring.capacity(), 4);
+        ASSERT_TRUE(ring.empty());
+
+        for (int i = 0; i < 4; ++i)
+        {
+            ASSERT_TRUE(ring.try_push(std::to_string(i)));
+        }
+        ASSERT_TRUE(!ring.try_push("full"));
+        ASSERT_EQ(ring.size(), 4);
+
+        std::string out;
+        ASSERT_TRUE(ring.try_pop(out));
+        ASSERT_EQ(out, std::string("0"));
+        ASSERT_TRUE(ring.try_emplace(2, 'x'));
+        ASSERT_EQ(*ring.try_pop(), std::string("1"));
+        ASSERT_EQ(*ring.try_pop(), std::string("2"));
+        ASSERT_EQ(*ring.try_pop(), std::string("3"));
+        ASSERT_EQ(*ring.try_pop(), std::string("xx"));
+        ASSERT_TRUE(!ring.try_pop().has_value());
+
+        // 소멸자가 남은 원소를 정리하는지 (ASan/LSan으로 확인)
+        ring.try_push(std::string(100, 'y'));
+    }
+
+    // 2. 링 끝을 넘어가는 배치 쓰기/읽기
+    {
+        sw::spsc_ring<int> ring{ 8 };
+        const std::vector<int> input{ 1, 2, 3, 4, 5, 6 };
+        ASSERT_EQ(ring.write(input), 6);
+
+        int out[4];
+        ASSERT_EQ(ring.read(out), 4);
+        ASSERT_EQ(out[3], 4);
+
+        // 남은 공간(6)보다 많이 쓰면 가능한 만큼만 씀
+        const std::vector<int> more{ 7, 8, 9, 10, 11, 12, 13, 14 };
+        ASSERT_EQ(ring.write(more), 6);
+
+        int all[16];
+        ASSERT_EQ(ring.read(all), 8);
+        for (int i = 0; i < 8; ++i)
+        {
+            ASSERT_EQ(all[i], i + 5);
+        }
+        ASSERT_EQ(ring.read(all), 0);
+    }
+
+    // 3. 두 스레드 간 배치 전송
+    {
+        constexpr int total = 200000;
+        sw::spsc_ring<int> ring{ 1024 };
+
+        std::thread producer{ [&]
+        {
+            int next = 0;
+            int batch[37];
+            while (next < total)
+            {
+                const int n = std::min<int>(37, total - next);
+                for (int i = 0; i < n; ++i)
+                {
+                    batch[i] = next + i;
+                }
+                next += static_cast<int>(ring.write(std::span<const int>{ batch, static_cast<sw::usize>(n) }));
+            }
+        } };
+
+        int expected = 0;
+        bool in_order = true;
+        int buffer[64];
+        while (expected < total)
+        {
+            const sw::usize n = ring.read(buffer);
+            for (sw::usize i = 0; i < n; ++i)
+            {
+                in_order &= (buffer[i] == expected++);
+            }
+        }
+        producer.join();
+        ASSERT_TRUE(in_order);
+        ASSERT_TRUE(ring.empty());
+    }
+
+    // 4. 바이트 링: 가변 길이 레코드, 끝에서 감기
+    {
+        sw::spsc_byte_ring ring{ 64 };
+        ASSERT_EQ(ring.capacity(), 64);
+
+        const std::string first = "hello, ring";
+        ASSERT_TRUE(ring.try_write(std::as_bytes(std::span{ first })));
+
+        // 제자리 쓰기
+        auto dest = ring.reserve(16);
+        ASSERT_EQ(dest.size(), 16);
+        std::memcpy(dest.data(), "abc", 3);
+        ring.commit(3);
+
+        auto record = ring.peek();
+        ASSERT_EQ(std::string(reinterpret_cast<const char*>(record.data()), record.size()), first);
+        ring.release();
+        ASSERT_TRUE(ring.try_read([](std::span<const std::byte> r)
+        {
+            ASSERT_EQ(std::string(reinterpret_cast<const char*>(r.data()), r.size()), std::string("abc"));
+        }));
+        ASSERT_TRUE(ring.empty());
+
+        // head는 40: 8바이트 레코드(헤더 포함 16)를 쓰면 끝에 8바이트만 남으므로
+        // 다음 20바이트 레코드(헤더 포함 32)는 남은 공간을 건너뛰고 처음으로 감김
+        const std::string a(8, 'a');
+        const std::string b(20, 'b');
+        ASSERT_TRUE(ring.try_write(std::as_bytes(std::span{ a })));
+        ASSERT_TRUE(ring.try_write(std::as_bytes(std::span{ b })));
+        ASSERT_TRUE(!ring.try_write(std::as_bytes(std::span{ b })));
+
+        std::vector<std::string> received;
+        while (ring.try_read([&](std::span<const std::byte> r)
+        {
+            received.emplace_back(reinterpret_cast<const char*>(r.data()), r.size());
+        }))
+        {
+        }
+        ASSERT_EQ(received.size(), 2);
+        ASSERT_EQ(received[0], a);
+        ASSERT_EQ(received[1], b);
+        ASSERT_TRUE(ring.peek().data() == nullptr);
+    }
+
+    // 5. 바이트 링: 두 스레드 간 가변 길이 레코드 전송
+    {
+        constexpr sw::u32 total = 50000;
+        sw::spsc_byte_ring ring{ 4096 };
+
+        std::thread producer{ [&]
+        {
+            for (sw::u32 i = 0; i < total;)
+            {
+                // 레코드 = [i][i % 50개의 바이트]
+                const sw::usize size = sizeof(sw::u32) + i % 50;
+                auto dest = ring.reserve(size);
+                if (dest.data() == nullptr)
+                {
+                    continue;
+                }
+                std::memcpy(dest.data(), &i, sizeof(i));
+                std::memset(dest.data() + sizeof(i), static_cast<int>(i & 0xFF), size - sizeof(i));
+                ring.commit(size);
+                ++i;
+            }
+        } };
+
+        sw::u32 expected = 0;
+        bool valid = true;
+        while (expected < total)
+        {
+            ring.try_read([&](std::span<const std::byte> r)
+            {
+                sw::u32 value;
+                std::memcpy(&value, r.data(), sizeof(value));
+                valid &= (value == expected) && (r.size() == sizeof(sw::u32) + expected % 50);
+                for (sw::usize i = sizeof(value); i < r.size(); ++i)
+                {
+                    valid &= (r[i] == static_cast<std::byte>(expected & 0xFF));
+                }
+                ++expected;
+            });
+        }
+        producer.join();
+        ASSERT_TRUE(valid);
+    }
+}
+
+TEST_MAIN
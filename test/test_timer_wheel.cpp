@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "sw/timer_wheel.hpp"
+#include "utils.hpp"
+
+void run_tests()
+{
+    // 1. 마감 시각에 정확히 한 번 실행
+    {
+        sw::timer_wheel timers;
+        std::vector<sw::u64> fired;
+        timers.schedule_at(10, [&] { fired.push_back(timers.now()); });
+        timers.schedule_at(3, [&] { fired.push_back(timers.now()); });
+        timers.schedule_after(5000, [&] { fired.push_back(timers.now()); });
+        ASSERT_EQ(timers.size(), 3);
+        ASSERT_EQ(timers.next_expiry().value(), 3);
+
+        ASSERT_EQ(timers.advance(2), 0);
+        ASSERT_EQ(timers.advance(10), 2);
+        ASSERT_EQ(fired.size(), 2);
+        ASSERT_EQ(fired[0], 3);
+        ASSERT_EQ(fired[1], 10);
+
+        ASSERT_EQ(timers.advance(4999), 0);
+        ASSERT_EQ(timers.advance(100000), 1);
+        ASSERT_EQ(fired[2], 5000);
+        ASSERT_EQ(timers.now(), 100000);
+        ASSERT_TRUE(timers.empty());
+        ASSERT_TRUE(!timers.next_expiry());
+    }
+
+    // 2. 취소와 오래된 핸들
+    {
+        sw::timer_wheel timers;
+        int calls = 0;
+        auto a = timers.schedule_after(100, [&] { ++calls; });
+        auto b = timers.schedule_after(100, [&] { ++calls; });
+        ASSERT_TRUE(timers.contains(a));
+        ASSERT_EQ(timers.deadline(a).value(), 100);
+        ASSERT_TRUE(timers.cancel(a));
+        ASSERT_TRUE(!timers.cancel(a));
+        ASSERT_TRUE(!timers.contains(a));
+
+        // 취소한 노드를 재사용해도 이전 핸들은 무효
+        auto c = timers.schedule_after(50, [&] { calls += 10; });
+        ASSERT_EQ(c.index, a.index);
+        ASSERT_TRUE(!timers.contains(a));
+
+        ASSERT_EQ(timers.advance(1000), 2);
+        ASSERT_EQ(calls, 11);
+        ASSERT_TRUE(!timers.contains(b));
+        ASSERT_TRUE(!timers.cancel(b));
+    }
+
+    // 3. 콜백 안에서 등록/취소
+    {
+        sw::timer_wheel timers{ 1000 };
+        int repeats = 0;
+        sw::timer_handle victim;
+        sw::function<void()> tick = [&]
+        {
+            if (++repeats < 5)
+            {
+                timers.schedule_after(0, tick); // 지난 시각은 다음 틱으로
+            }
+        };
+        timers.schedule_after(1, tick);
+        timers.schedule_after(1, [&] { timers.cancel(victim); });
+        victim = timers.schedule_after(1, [&] { repeats += 100; });
+
+        ASSERT_EQ(timers.advance(1001), 2);
+        ASSERT_EQ(repeats, 1);
+        ASSERT_EQ(timers.advance(1010), 4);
+        ASSERT_EQ(repeats, 5);
+    }
+
+    // 4. 임의 마감 시각: 모두 마감 시각 순서로 실행됨 (여러 단계에 걸친 cascade)
+    {
+        sw::timer_wheel timers{ 12345 };
+        std::mt19937_64 rng{ 42 };
+        std::vector<sw::u64> deadlines;
+        std::vector<sw::u64> fired;
+        std::vector<sw::timer_handle> handles;
+        for (int i = 0; i < 20000; ++i)
+        {
+            const sw::u64 delay = rng() % (sw::u64{ 1 } << (rng() % 40));
+            handles.push_back(timers.schedule_after(delay, [&, deadline = timers.now() + std::max<sw::u64>(delay, 1)]
+            {
+                ASSERT_EQ(timers.now(), deadline);
+                fired.push_back(deadline);
+            }));
+        }
+
+        // 절반 취소
+        for (sw::usize i = 0; i < handles.size(); i += 2)
+        {
+            deadlines.push_back(timers.deadline(handles[i + 1]).value());
+            ASSERT_TRUE(timers.cancel(handles[i]));
+        }
+        ASSERT_EQ(timers.size(), 10000);
+
+        sw::u64 now = timers.now();
+        while (!timers.empty())
+        {
+            now += rng() % (sw::u64{ 1 } << 36);
+            timers.advance(now);
+        }
+
+        std::ranges::sort(deadlines);
+        ASSERT_TRUE(fired == deadlines);
+    }
+
+    // 5. clear
+    {
+        sw::timer_wheel timers;
+        int calls = 0;
+        auto handle = timers.schedule_after(10, [&] { ++calls; });
+        timers.clear();
+        ASSERT_TRUE(timers.empty());
+        ASSERT_TRUE(!timers.contains(handle));
+        ASSERT_EQ(timers.advance(100), 0);
+        ASSERT_EQ(calls, 0);
+    }
+}
+
+TEST_MAIN
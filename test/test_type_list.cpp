@@ -0,0 +1,92 @@
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "sw/type_list.hpp"
+#include "sw/tuple.hpp"
+#include "utils.hpp"
+
+namespace
+{
+template <sw::usize I>
+using tag = std::integral_constant<sw::usize, I>;
+
+template <typename T>
+struct is_even_tag : std::bool_constant<T::value % 2 == 0> {};
+
+template <typename T>
+struct modulo_tag
+{
+    using type = tag<T::value % 10>;
+};
+
+template <typename T>
+using modulo_tag_t = typename modulo_tag<T>::type;
+
+// 큰 목록 (재귀 구현이라면 인스턴스화 깊이 한도를 넘는 길이)
+template <sw::usize... I>
+auto make_tags(std::index_sequence<I...>) -> sw::type_list<tag<I>...>;
+
+using large_list = decltype(make_tags(std::make_index_sequence<2000>{}));
+}
+
+void run_tests()
+{
+    using list = sw::type_list<int, float, int, double, char, float>;
+
+    // 1. 크기, 인덱스 접근, 검색
+    {
+        static_assert(list::size == 6);
+        static_assert(std::is_same_v<sw::type_at_t<list, 0>, int>);
+        static_assert(std::is_same_v<sw::type_at_t<list, 3>, double>);
+        static_assert(sw::index_of_v<list, float> == 1);
+        static_assert(sw::index_of_v<list, long> == sw::type_npos);
+        static_assert(sw::contains_v<list, char>);
+        static_assert(!sw::contains_v<sw::type_list<>, char>);
+        static_assert(sw::find_if_v<list, std::is_floating_point> == 1);
+        static_assert(sw::find_if_v<list, std::is_pointer> == sw::type_npos);
+        ASSERT_EQ((sw::index_of_v<list, double>), 3);
+    }
+
+    // 2. filter, unique, transform
+    {
+        static_assert(std::is_same_v<sw::filter_t<list, std::is_floating_point>, sw::type_list<float, double, float>>);
+        static_assert(std::is_same_v<sw::filter_t<list, std::is_pointer>, sw::type_list<>>);
+        static_assert(std::is_same_v<sw::unique_t<list>, sw::type_list<int, float, double, char>>);
+        static_assert(std::is_same_v<sw::unique_t<sw::type_list<>>, sw::type_list<>>);
+        static_assert(std::is_same_v<sw::transform_t<sw::type_list<int, char>, std::add_pointer_t>, sw::type_list<int*, char*>>);
+    }
+
+    // 3. concat, flatten, 튜플 변환
+    {
+        static_assert(std::is_same_v<sw::concat_t<>, sw::type_list<>>);
+        static_assert(std::is_same_v<sw::concat_t<sw::type_list<int>, sw::type_list<>, sw::type_list<float, char>>,
+                                     sw::type_list<int, float, char>>);
+
+        using nested = sw::type_list<int, sw::type_list<float, sw::type_list<double, char>>, sw::type_list<>>;
+        static_assert(std::is_same_v<sw::flatten_t<nested>, sw::type_list<int, float, double, char>>);
+
+        static_assert(std::is_same_v<sw::to_type_list_t<std::tuple<int, float>>, sw::type_list<int, float>>);
+        static_assert(std::is_same_v<sw::to_type_list_t<void(int, char)>, sw::type_list<int, char>>);
+        static_assert(std::is_same_v<sw::rebind_t<list, std::tuple>, std::tuple<int, float, int, double, char, float>>);
+
+        // flatten_tuple_t는 type_list 위에서 동작
+        using nested_tuple = std::tuple<int, std::tuple<float, std::tuple<double>>, char>;
+        static_assert(std::is_same_v<sw::flatten_tuple_t<nested_tuple>, std::tuple<int, float, double, char>>);
+        static_assert(std::is_same_v<sw::flatten_tuple_t<nested_tuple, sw::type_list>, sw::type_list<int, float, double, char>>);
+    }
+
+    // 4. 긴 목록에서도 인스턴스화 깊이가 늘지 않음
+    {
+        static_assert(large_list::size == 2000);
+        static_assert(std::is_same_v<sw::type_at_t<large_list, 1999>, tag<1999>>);
+        static_assert(sw::index_of_v<large_list, tag<1500>> == 1500);
+        static_assert(sw::filter_t<large_list, is_even_tag>::size == 1000);
+        static_assert(std::is_same_v<sw::unique_t<sw::transform_t<large_list, modulo_tag_t>>,
+                                     decltype(make_tags(std::make_index_sequence<10>{}))>);
+        static_assert(sw::concat_t<large_list, large_list>::size == 4000);
+        ASSERT_EQ((sw::filter_t<large_list, is_even_tag>::size), 1000);
+    }
+}
+
+TEST_MAIN
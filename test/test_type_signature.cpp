@@ -21,6 +21,13 @@ void run_tests()
     ASSERT_EQ(sw::type_name<const int volatile&>(), "int");
 
     ASSERT_EQ(sw::type_name<const int volatile* const** const volatile*** const&>(), "int");
+
+    // 이름은 시그니처가 아닌 전용 널 종료 배열을 가리키고, type_name은 full_type_name의 접미사
+    constexpr auto full_name = sw::full_type_name<my_ns::MyStruct>();
+    constexpr auto short_name = sw::type_name<my_ns::MyStruct>();
+    ASSERT_EQ(full_name.data()[full_name.size()], '\0');
+    ASSERT_TRUE(short_name.data() == full_name.data() + full_name.size() - short_name.size());
+    ASSERT_TRUE(sw::raw_type_name<my_ns::MyStruct>().ends_with(full_name));
 }
 
 TEST_MAIN
@@ -1,6 +1,16 @@
+#include <memory>
+#include <string>
+
 #include "sw/type_traits.hpp"
 #include "utils.hpp"
 
+struct Relocatable
+{
+    std::unique_ptr<int> ptr;
+};
+
+SW_TRIVIALLY_RELOCATABLE(Relocatable);
+
 void free_function(int, float)
 {
 }
@@ -27,6 +37,20 @@ void run_tests()
     };
     using M = sw::function_traits<decltype(&S::mem)>;
     static_assert(M::arity == 1);
+
+    // Trivially relocatable
+    struct Pod
+    {
+        int a;
+        float b;
+    };
+    static_assert(sw::is_trivially_relocatable_v<int>);
+    static_assert(sw::is_trivially_relocatable_v<Pod>);
+    static_assert(sw::is_trivially_relocatable_v<const Pod>);
+    static_assert(sw::is_trivially_relocatable_v<Pod[4]>);
+    static_assert(!sw::is_trivially_relocatable_v<std::string>);
+    static_assert(!sw::is_trivially_relocatable_v<std::unique_ptr<int>>);
+    static_assert(sw::is_trivially_relocatable_v<Relocatable>);
 }
 
 TEST_MAIN
@@ -0,0 +1,89 @@
+#include <cstring>
+
+#include "sw/virtual_arena.hpp"
+#include "utils.hpp"
+
+void run_tests()
+{
+    constexpr sw::usize reserve = sw::usize{ 1 } << 30; // 1GiB
+
+    // 1. 예약만 하고 커밋은 사용한 만큼만
+    {
+        sw::virtual_arena arena{ reserve };
+        ASSERT_TRUE(arena.reserved_bytes() >= reserve);
+        ASSERT_EQ(arena.committed_bytes(), 0);
+
+        auto* bytes = static_cast<sw::u8*>(arena.allocate(100, 1));
+        std::memset(bytes, 0xAB, 100);
+        ASSERT_TRUE(arena.committed_bytes() >= 100);
+        ASSERT_TRUE(arena.committed_bytes() < reserve);
+
+        void* aligned = arena.allocate(8, 256);
+        ASSERT_EQ(reinterpret_cast<sw::usize>(aligned) % 256, 0);
+    }
+
+    // 2. 성장해도 포인터가 재배치되지 않음
+    {
+        sw::virtual_arena arena{ reserve };
+        auto* first = arena.allocate_array<sw::u64>(16);
+        first[0] = 42;
+
+        for (int i = 0; i < 64; ++i)
+        {
+            auto* chunk = static_cast<sw::u8*>(arena.allocate(256 * 1024));
+            chunk[0] = 1;
+        }
+        ASSERT_EQ(first[0], 42);
+        ASSERT_TRUE(arena.data() == reinterpret_cast<sw::u8*>(first));
+        ASSERT_TRUE(arena.used_bytes() >= 64 * 256 * 1024);
+    }
+
+    // 3. marker / reset
+    {
+        sw::virtual_arena arena{ reserve };
+        (void)arena.allocate(64);
+        const auto marker = arena.get_marker();
+        void* p = arena.allocate(64);
+        (void)arena.allocate(1 << 20);
+        arena.rewind(marker);
+        ASSERT_EQ(arena.allocate(64), p);
+
+        arena.reset();
+        ASSERT_EQ(arena.used_bytes(), 0);
+        ASSERT_EQ(arena.committed_bytes(), 0);
+
+        // decommit 후 다시 커밋하여 사용 가능
+        auto* value = arena.create<int>(7);
+        ASSERT_EQ(*value, 7);
+    }
+
+    // 4. 예약 범위를 넘는 할당
+    {
+        sw::virtual_arena arena{ 1 << 20 };
+        bool caught = false;
+        try
+        {
+            (void)arena.allocate(arena.reserved_bytes() + 1);
+        }
+        catch (const std::bad_alloc&)
+        {
+            caught = true;
+        }
+        ASSERT_TRUE(caught);
+    }
+
+    // 5. huge page 모드 (지원하지 않는 환경에서도 동작해야 함)
+    {
+        sw::virtual_arena thp{ reserve, sw::huge_page_mode::transparent };
+        ASSERT_EQ(reinterpret_cast<sw::usize>(thp.data()) % (2 * 1024 * 1024), 0);
+        auto* data = thp.allocate_array<sw::u32>(1 << 20);
+        data[(1 << 20) - 1] = 5;
+        ASSERT_EQ(data[(1 << 20) - 1], 5);
+
+        sw::virtual_arena huge{ 4 * 1024 * 1024, sw::huge_page_mode::explicit_ };
+        auto* value = huge.create<sw::u64>(9);
+        ASSERT_EQ(*value, 9);
+    }
+}
+
+TEST_MAIN